@@ -0,0 +1,140 @@
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+#include "include/maze.hpp"
+#include "include/maze_generator.hpp"
+
+// 迷宫生成和最短路径求解的规模基准
+// 从 64×64 到 4096×4096，每种大小生成若干迷宫并用同一个求解器反复求解，
+// 输出每个格子的平均用时：各行基本相同说明用时随格子数线性增长
+
+namespace
+{
+
+constexpr std::array<int, 7> SIZES = {64, 128, 256, 512, 1024, 2048, 4096};
+constexpr std::size_t CELLS_PER_SIZE = std::size_t{1} << 24; // 每种大小累计处理的格子数
+constexpr std::array<SolveAlgorithm, 4> ALGORITHMS = {
+    SolveAlgorithm::BFS, SolveAlgorithm::A_STAR, SolveAlgorithm::BIDIRECTIONAL_BFS,
+    SolveAlgorithm::BIT_BFS};
+
+using Clock = std::chrono::steady_clock;
+
+// 每个格子的纳秒数
+double ns_per_cell(std::chrono::nanoseconds elapsed, std::size_t cells)
+{
+    return static_cast<double>(elapsed.count()) / static_cast<double>(cells);
+}
+
+// 求解器与迷宫大小不同时每种算法都必须拒绝求解，而不是只搜索迷宫的一部分
+bool check_size_mismatch()
+{
+    Position start{};
+    Position end{};
+    DynamicMazeGenerator generator(201, 201, 2206);
+    DynamicMaze maze(generator.generate(start, end), start, end);
+    MazeSolver solver(63, 63);
+
+    for (SolveAlgorithm algorithm : ALGORITHMS)
+    {
+        try
+        {
+            (void)maze.find_path(solver, algorithm);
+            return false;
+        }
+        catch (const std::invalid_argument&)
+        {
+        }
+    }
+
+    // 直接传入位网格的两个入口同样要检查
+    try
+    {
+        (void)solver.solve(maze.walls(), start, end);
+        return false;
+    }
+    catch (const std::invalid_argument&)
+    {
+    }
+    try
+    {
+        (void)solver.reachable(maze.walls(), start);
+        return false;
+    }
+    catch (const std::invalid_argument&)
+    {
+    }
+    return true;
+}
+
+} // namespace
+
+int main()
+{
+    if (!check_size_mismatch())
+    {
+        std::cerr << "求解器与迷宫大小不同时没有报错\n";
+        return 1;
+    }
+
+    std::cout << "=== 迷宫规模基准 ===\n";
+    std::cout << "每个格子的平均用时（纳秒）\n\n";
+    std::cout << std::setw(6) << "边长" << std::setw(8) << "次数" << std::setw(10) << "生成";
+    std::cout << std::setw(10) << "BFS" << std::setw(10) << "A*" << std::setw(10) << "双向BFS"
+              << std::setw(10) << "位并行BFS" << std::setw(10) << "连通性" << std::setw(12) << "路径长度" << "\n";
+
+    for (int size : SIZES)
+    {
+        const std::size_t cells = static_cast<std::size_t>(size) * static_cast<std::size_t>(size);
+        const std::size_t rounds = CELLS_PER_SIZE / cells > 0 ? CELLS_PER_SIZE / cells : 1;
+
+        // 生成器和求解器在同一种大小的所有轮次中重复使用
+        DynamicMazeGenerator generator(size, size, 2206);
+        MazeSolver solver(size, size);
+        std::chrono::nanoseconds generateTime{};
+        std::array<std::chrono::nanoseconds, ALGORITHMS.size()> solveTime{};
+        std::chrono::nanoseconds floodTime{};
+        std::size_t pathLength = 0;
+
+        for (std::size_t round = 0; round < rounds; ++round)
+        {
+            Position start{};
+            Position end{};
+            const auto begin = Clock::now();
+            DynamicMaze maze(generator.generate(start, end), start, end);
+            generateTime += Clock::now() - begin;
+
+            for (std::size_t a = 0; a < ALGORITHMS.size(); ++a)
+            {
+                const SolveResult result = maze.find_path(solver, ALGORITHMS[a]);
+                solveTime[a] += result.elapsed;
+                pathLength = result.path.size();
+            }
+
+            // 字级连通性检测
+            const auto floodBegin = Clock::now();
+            const BitGrid& reached = solver.reachable(maze.walls(), start);
+            floodTime += Clock::now() - floodBegin;
+            if (!reached.test(end))
+            {
+                std::cerr << "连通性检测结果错误\n";
+                return 1;
+            }
+        }
+
+        const std::size_t total = cells * rounds;
+        std::cout << std::setw(6) << size << std::setw(8) << rounds << std::fixed
+                  << std::setprecision(1) << std::setw(10) << ns_per_cell(generateTime, total);
+        for (const auto& elapsed : solveTime)
+        {
+            std::cout << std::setw(10) << ns_per_cell(elapsed, total);
+        }
+        std::cout << std::setw(10) << ns_per_cell(floodTime, total) << std::setw(12) << pathLength
+                  << "\n";
+    }
+
+    return 0;
+}
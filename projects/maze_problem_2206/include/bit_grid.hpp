@@ -0,0 +1,122 @@
+#ifndef BIT_GRID_HPP
+#define BIT_GRID_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "position.hpp"
+
+// 每个格子1位的网格（墙、访问标记等）
+//
+// 第 col 列在该行第 col / 64 个字的第 col % 64 位；每行补齐到缓存行（8个字）的整数倍，
+// 缓冲区按缓存行对齐。补齐的位与构造时的初始值相同（墙的网格初始为1，补齐部分也算墙）。
+// 一个字同时保存同一行的64个格子，搜索时可以用一次位运算处理64个格子
+class BitGrid
+{
+public:
+    static constexpr int WORD_BITS = 64;
+    static constexpr std::size_t ALIGNMENT = 64;                                    // 缓存行大小
+    static constexpr std::size_t WORDS_PER_LINE = ALIGNMENT / sizeof(std::uint64_t); // 每个缓存行的字数
+
+private:
+    struct AlignedDelete
+    {
+        void operator()(std::uint64_t* data) const noexcept
+        {
+            ::operator delete[](data, std::align_val_t{ALIGNMENT});
+        }
+    };
+
+    int _rows = 0;
+    int _cols = 0;
+    std::size_t _stride = 0; // 每行的字数（含补齐）
+    std::unique_ptr<std::uint64_t[], AlignedDelete> _words;
+
+public:
+    BitGrid() = default;
+
+    // 构造函数（所有位，包括补齐部分，都初始化为 value）
+    BitGrid(int rows, int cols, bool value = false)
+        : _rows(rows), _cols(cols),
+          _stride((static_cast<std::size_t>(cols) + WORD_BITS * WORDS_PER_LINE - 1) /
+                  (WORD_BITS * WORDS_PER_LINE) * WORDS_PER_LINE),
+          _words(static_cast<std::uint64_t*>(
+              ::operator new[](std::max<std::size_t>(word_count(), 1) * sizeof(std::uint64_t),
+                               std::align_val_t{ALIGNMENT})))
+    {
+        assign(value);
+    }
+
+    BitGrid(const BitGrid& other) : BitGrid(other._rows, other._cols)
+    {
+        std::copy_n(other._words.get(), word_count(), _words.get());
+    }
+
+    BitGrid& operator=(const BitGrid& other)
+    {
+        if (this != &other)
+        {
+            *this = BitGrid(other);
+        }
+        return *this;
+    }
+
+    // 移动后原对象变为 0x0 的空网格
+    BitGrid(BitGrid&& other) noexcept
+        : _rows(std::exchange(other._rows, 0)), _cols(std::exchange(other._cols, 0)),
+          _stride(std::exchange(other._stride, 0)), _words(std::move(other._words))
+    {
+    }
+
+    BitGrid& operator=(BitGrid&& other) noexcept
+    {
+        _rows = std::exchange(other._rows, 0);
+        _cols = std::exchange(other._cols, 0);
+        _stride = std::exchange(other._stride, 0);
+        _words = std::move(other._words);
+        return *this;
+    }
+
+    [[nodiscard]] int rows() const noexcept { return _rows; }
+    [[nodiscard]] int cols() const noexcept { return _cols; }
+    [[nodiscard]] std::size_t words_per_row() const noexcept { return _stride; }
+    [[nodiscard]] std::size_t word_count() const noexcept
+    {
+        return static_cast<std::size_t>(_rows) * _stride;
+    }
+
+    // 格子所在的字（按行优先编号）和字内的位
+    [[nodiscard]] std::size_t word_index(const Position& pos) const noexcept
+    {
+        return static_cast<std::size_t>(pos.row) * _stride +
+               static_cast<std::size_t>(pos.col / WORD_BITS);
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t bit_of(int col) noexcept
+    {
+        return std::uint64_t{1} << (col % WORD_BITS);
+    }
+
+    [[nodiscard]] std::uint64_t& word(std::size_t index) noexcept { return _words[index]; }
+    [[nodiscard]] std::uint64_t word(std::size_t index) const noexcept { return _words[index]; }
+
+    [[nodiscard]] bool test(const Position& pos) const noexcept
+    {
+        return (_words[word_index(pos)] & bit_of(pos.col)) != 0;
+    }
+
+    void set(const Position& pos) noexcept { _words[word_index(pos)] |= bit_of(pos.col); }
+    void reset(const Position& pos) noexcept { _words[word_index(pos)] &= ~bit_of(pos.col); }
+
+    // 所有位（包括补齐部分）设为 value
+    void assign(bool value) noexcept
+    {
+        std::fill_n(_words.get(), word_count(), value ? ~std::uint64_t{0} : std::uint64_t{0});
+    }
+};
+
+#endif // BIT_GRID_HPP
@@ -2,19 +2,26 @@
 #define MAZE_HPP
 
 #include <array>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
+#include "bit_grid.hpp"
+#include "maze_grid.hpp"
+#include "maze_solver.hpp"
 #include "position.hpp"
 
-// 迷宫类模板
-template <std::size_t N>
-class Maze
+// 迷宫类（运行期大小，可以是长方形）
+class DynamicMaze
 {
 private:
-    std::array<std::array<char, N>, N> _grid;
+    MazeGrid _grid;
+    BitGrid _walls; // 墙的位网格（与 _grid 同步，不含可视化标记）
     Position _start;
     Position _end;
     int _steps = 0;
+    SolveObserver* _observer = nullptr; // 遍历过程的观察者（可以为空）
 
     // 四个方向的偏移量（上、右、下、左）
     static constexpr std::array<Position, 4> _directions = {{
@@ -24,14 +31,37 @@ private:
         {0, -1}  // LEFT
     }};
 
+    // 遍历栈的一帧：格子位置、进入时面向的方向、下一个要尝试的方向序号
+    struct TraverseFrame
+    {
+        Position pos;
+        Direction facing;
+        std::uint8_t next;
+    };
+
+    std::vector<TraverseFrame> _stack; // 遍历用的显式栈（代替递归）
+
     // 右手法则
     bool traverse_right_hand(Position current, Direction facing);
     // 深度优先
     bool traverse_dfs(Position current);
 
+    // 进入 / 回溯离开一个格子
+    bool enter(const Position& pos);
+    void leave();
+
+    // 通知观察者
+    void notify_expand(const Position& pos);
+    void notify_backtrack(const Position& pos);
+
 public:
     // 构造函数
-    Maze(const std::array<std::array<char, N>, N>& grid, Position start, Position end);
+    DynamicMaze(MazeGrid grid, Position start, Position end);
+
+    [[nodiscard]] int rows() const noexcept { return _grid.rows(); }
+    [[nodiscard]] int cols() const noexcept { return _grid.cols(); }
+    [[nodiscard]] const MazeGrid& grid() const noexcept { return _grid; }
+    [[nodiscard]] const BitGrid& walls() const noexcept { return _walls; }
 
     // 检查位置是否有效
     [[nodiscard]] bool is_valid(const Position& pos) const noexcept;
@@ -39,20 +69,72 @@ public:
     // 检查位置是否可以访问
     [[nodiscard]] bool can_visit(const Position& pos) const noexcept;
 
+    // 检查位置是否不是墙（最短路径求解用，不受遍历标记影响）
+    [[nodiscard]] bool is_open(const Position& pos) const noexcept;
+
     // 打印迷宫
     void display() const;
+    void display(int step) const;
 
     // 标记位置
     void mark(const Position& pos, char marker);
 
+    // 标记整条路径
+    void mark_path(const std::vector<Position>& path, char marker = '*');
+
     // 获取字符
     [[nodiscard]] char get_char(const Position& pos) const;
 
-    // 开始遍历
+    // 开始遍历（带动画演示和输出）
     bool solve(bool useRightHand = true);
+
+    // 开始遍历（不输出，observer 为空时没有任何渲染）
+    bool solve(bool useRightHand, SolveObserver* observer);
+
+    // 求最短路径，不修改迷宫，也不做任何渲染（除非传入 observer）
+    [[nodiscard]] SolveResult find_path(SolveAlgorithm algorithm,
+                                        SolveObserver* observer = nullptr) const;
+
+    // 同上，使用调用者提供的求解器（批量求解时重复使用工作数组）
+    // 求解器的大小必须与迷宫相同，否则抛出 std::invalid_argument
+    [[nodiscard]] SolveResult find_path(MazeSolver& solver, SolveAlgorithm algorithm,
+                                        SolveObserver* observer = nullptr) const;
+};
+
+// 迷宫类模板：编译期固定大小的 N×N 迷宫，算法与 DynamicMaze 完全相同
+template <std::size_t N>
+class Maze : public DynamicMaze
+{
+public:
+    // 构造函数
+    Maze(const std::array<std::array<char, N>, N>& grid, Position start, Position end)
+        : DynamicMaze(MazeGrid(grid), start, end)
+    {
+    }
+};
+
+// 动画观察者：每展开一个格子就标记并重绘迷宫，然后暂停一会儿
+// 只用于交互演示，批量求解时不要使用
+class MazeAnimation : public SolveObserver
+{
+private:
+    DynamicMaze& _maze;
+    std::chrono::milliseconds _delay;
+    int _steps = 0;
+
+public:
+    explicit MazeAnimation(DynamicMaze& maze,
+                           std::chrono::milliseconds delay = std::chrono::milliseconds(300))
+        : _maze(maze), _delay(delay)
+    {
+    }
+
+    void on_expand(const Position& pos) override;
+    void on_backtrack(const Position& pos) override;
+    void on_path(const std::vector<Position>& path) override;
 };
 
-// 由于是模板类，需要在头文件中包含实现
+// 实现（全部为内联函数，保持只有头文件）
 #include "../src/maze.tpp"
 
 #endif // MAZE_HPP
@@ -4,55 +4,91 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <random>
+#include <utility>
 #include <vector>
 
+#include "maze_grid.hpp"
 #include "position.hpp"
+#include "ring_frontier.hpp"
 
-// 迷宫生成器类模板
-template <std::size_t N>
-class MazeGenerator
+// 迷宫生成器类（运行期大小，可以是长方形）
+class DynamicMazeGenerator
 {
 private:
-    std::array<std::array<char, N>, N> _grid;
-    std::mt19937 rng_; // 梅森（Mersenne Twister）旋转引擎随机数生成器
+    // 挖洞栈的一帧：格子位置、打乱后的方向顺序（每个方向2位）、下一个要尝试的方向序号
+    struct CarveFrame
+    {
+        int row;
+        int col;
+        std::uint8_t order;
+        std::uint8_t next;
+    };
+
+    // 四个方向：上、右、下、左（跳2格，保持墙的间隔）
+    static constexpr std::array<Position, 4> _carveDirections = {{
+        {-2, 0}, // UP
+        {0, 2},  // RIGHT
+        {2, 0},  // DOWN
+        {0, -2}  // LEFT
+    }};
+
+    int _rows;
+    int _cols;
+    MazeGrid _grid;
+    std::vector<CarveFrame> _stack;    // 挖洞用的显式栈，多次生成时重复使用
+    RingFrontier<Position> _frontier;  // 可达性检测的BFS队列
+    std::vector<bool> _visited;        // 可达性检测的访问标记
+    std::vector<Position> _candidates; // 出口候选位置
+    std::mt19937 rng_;                 // 梅森（Mersenne Twister）旋转引擎随机数生成器
 
     // 检查位置是否在范围内
-    [[nodiscard]] constexpr bool is_in_bounds(int row, int col) const noexcept
+    [[nodiscard]] bool is_in_bounds(int row, int col) const noexcept
+    {
+        return row >= 0 && row < _rows && col >= 0 && col < _cols;
+    }
+
+    // 随机打乱方向顺序，打包成一个字节
+    [[nodiscard]] std::uint8_t shuffled_order()
     {
-        return row >= 0 && row < static_cast<int>(N) && col >= 0 && col < static_cast<int>(N);
+        std::array<std::uint8_t, 4> order = {0, 1, 2, 3};
+        std::shuffle(order.begin(), order.end(), rng_);
+        return static_cast<std::uint8_t>(order[0] | order[1] << 2 | order[2] << 4 | order[3] << 6);
     }
 
-    // 挖洞
+    // 挖洞（深度优先，显式栈代替递归，栈深度不受调用栈大小限制）
+    // 进入一个格子时打乱方向，与递归写法消耗随机数的顺序相同，同一个种子生成的迷宫不变
     void carve_passages_from(int row, int col)
     {
-        // 四个方向：上、右、下、左
-        std::array<Position, 4> directions = {{
-            {-2, 0}, // UP
-            {0, 2},  // RIGHT
-            {2, 0},  // DOWN
-            {0, -2}  // LEFT
-        }};
-
-        // 随机打乱方向顺序
-        std::shuffle(directions.begin(), directions.end(), rng_);
-
-        // 尝试每个方向
-        for (const auto& dir : directions)
+        _stack.clear();
+        _stack.push_back({row, col, shuffled_order(), 0});
+
+        while (!_stack.empty())
         {
-            int newRow = row + dir.row;
-            int newCol = col + dir.col;
+            CarveFrame& frame = _stack.back();
+            if (frame.next == 4)
+            {
+                // 四个方向都试过了，回溯
+                _stack.pop_back();
+                continue;
+            }
+
+            const Position& dir = _carveDirections[(frame.order >> (2 * frame.next)) & 3];
+            ++frame.next;
+            int newRow = frame.row + dir.row;
+            int newCol = frame.col + dir.col;
 
             // 检查新位置是否有效、未访问，且不在边界上
-            if (newRow > 0 && newRow < static_cast<int>(N) - 1 && newCol > 0 &&
-                newCol < static_cast<int>(N) - 1 && _grid[newRow][newCol] == '#')
+            if (newRow > 0 && newRow < _rows - 1 && newCol > 0 && newCol < _cols - 1 &&
+                _grid[newRow][newCol] == '#')
             {
                 // 打通当前位置和新位置之间的墙
-                _grid[row + dir.row / 2][col + dir.col / 2] = '.';
+                _grid[frame.row + dir.row / 2][frame.col + dir.col / 2] = '.';
                 _grid[newRow][newCol] = '.';
 
-                // 递归访问新位置
-                carve_passages_from(newRow, newCol);
+                // 访问新位置（frame 在 push_back 之后可能失效）
+                _stack.push_back({newRow, newCol, shuffled_order(), 0});
             }
         }
     }
@@ -60,82 +96,79 @@ private:
     // 确保边界是墙
     void ensure_borders()
     {
-        for (std::size_t i = 0; i < N; ++i)
+        for (int col = 0; col < _cols; ++col)
+        {
+            _grid[0][col] = '#';
+            _grid[_rows - 1][col] = '#';
+        }
+        for (int row = 0; row < _rows; ++row)
         {
-            _grid[0][i] = '#';
-            _grid[N - 1][i] = '#';
-            _grid[i][0] = '#';
-            _grid[i][N - 1] = '#';
+            _grid[row][0] = '#';
+            _grid[row][_cols - 1] = '#';
         }
     }
 
-    // 使用BFS从起点找到所有可达位置
-    std::vector<Position> find_reachable_positions(const Position& start)
+    // 使用BFS从起点访问所有可达位置，按访问顺序对每个位置调用 visit
+    // 队列和 visited 都是成员，多次生成时重复使用
+    template <typename Visit>
+    void for_each_reachable(const Position& start, Visit&& visit)
     {
-        std::vector<Position> reachable;
-        std::array<std::array<bool, N>, N> visited{};
-        std::vector<Position> queue;
+        _visited.assign(static_cast<std::size_t>(_rows) * _cols, false);
+        _frontier.clear();
 
-        queue.push_back(start);
-        visited[start.row][start.col] = true;
+        _frontier.push(start);
+        _visited[static_cast<std::size_t>(start.row) * _cols + start.col] = true;
 
         // 四个方向
         std::array<Position, 4> directions = {{{-1, 0}, {0, 1}, {1, 0}, {0, -1}}};
 
-        while (!queue.empty())
+        while (!_frontier.empty())
         {
-            Position current = queue.front();
-            queue.erase(queue.begin());
-            reachable.push_back(current);
+            Position current = _frontier.pop();
+            visit(current);
 
             for (const auto& dir : directions)
             {
                 int newRow = current.row + dir.row;
                 int newCol = current.col + dir.col;
 
-                if (is_in_bounds(newRow, newCol) && !visited[newRow][newCol] &&
-                    _grid[newRow][newCol] == '.')
+                if (!is_in_bounds(newRow, newCol))
                 {
-                    visited[newRow][newCol] = true;
-                    queue.push_back({newRow, newCol});
+                    continue;
+                }
+                const std::size_t index = static_cast<std::size_t>(newRow) * _cols + newCol;
+                if (!_visited[index] && _grid[newRow][newCol] == '.')
+                {
+                    _visited[index] = true;
+                    _frontier.push({newRow, newCol});
                 }
             }
         }
-
-        return reachable;
     }
 
     // 创建出口
     void create_exit(const Position& start, Position& exit)
     {
-        // 从起点找到所有可达位置
-        auto reachable = find_reachable_positions(start);
-
-        // 找到最右侧的列号
+        // 从起点访问所有可达位置，收集最右侧列上的位置（按访问顺序）
         int maxCol = 1;
-        for (const auto& pos : reachable)
-        {
+        _candidates.clear();
+        for_each_reachable(start, [this, &maxCol](const Position& pos) {
             if (pos.col > maxCol)
             {
                 maxCol = pos.col;
+                _candidates.clear();
             }
-        }
-
-        // 收集最右侧列的所有可达位置
-        std::vector<Position> candidates;
-        for (const auto& pos : reachable)
-        {
             if (pos.col == maxCol)
             {
-                candidates.push_back(pos);
+                _candidates.push_back(pos);
             }
-        }
+        });
 
         // 随机选择一个位置作为出口的内部位置
-        if (!candidates.empty())
+        if (!_candidates.empty())
         {
-            std::uniform_int_distribution<size_t> dist(0, candidates.size() - 1);
-            Position exitInside = candidates[dist(rng_)];
+            std::uniform_int_distribution<size_t> dist(0, _candidates.size() - 1);
+            Position exitInside = _candidates[dist(rng_)];
             // 在它右侧设置出口
             exit = {exitInside.row, exitInside.col + 1};
         }
@@ -148,29 +181,28 @@ private:
 
 public:
     // 构造函数
-    explicit MazeGenerator(unsigned int seed = std::random_device{}()) : rng_(seed)
+    DynamicMazeGenerator(int rows, int cols, unsigned int seed = std::random_device{}())
+        : _rows(rows), _cols(cols), rng_(seed)
     {
-        // 初始化为全墙
-        for (auto& row : _grid)
-        {
-            row.fill('#');
-        }
     }
 
-    // 生成迷宫
-    [[nodiscard]] std::array<std::array<char, N>, N> generate(Position& start, Position& end)
+    [[nodiscard]] int rows() const noexcept { return _rows; }
+    [[nodiscard]] int cols() const noexcept { return _cols; }
+
+    // 生成迷宫（网格移交给调用者，生成器不保留副本）
+    [[nodiscard]] MazeGrid generate(Position& start, Position& end)
     {
         // 初始化为全墙
-        for (auto& row : _grid)
-        {
-            row.fill('#');
-        }
+        _grid = MazeGrid(_rows, _cols, '#');
+
+        // 栈深度不超过可挖的格子数（奇数行、奇数列上的格子）
+        _stack.reserve(static_cast<std::size_t>((_rows - 1) / 2) * ((_cols - 1) / 2));
 
         // 起点设置为 (1, 1)
         start = {1, 1};
         _grid[1][1] = '.';
 
-        // 从起点开始递归生成迷宫
+        // 从起点开始生成迷宫
         carve_passages_from(1, 1);
 
         // 先创建出口（在确保边界之前）
@@ -182,11 +214,35 @@ public:
         // 打通出口：确保出口位置是可通过的
         _grid[end.row][end.col] = '.';
 
-        return _grid;
+        return std::move(_grid);
     }
 
     // 设置随机种子
     void set_seed(unsigned int seed) { rng_.seed(seed); }
 };
 
+// 迷宫生成器类模板：编译期固定大小的 N×N 迷宫，算法与 DynamicMazeGenerator 完全相同
+template <std::size_t N>
+class MazeGenerator
+{
+private:
+    DynamicMazeGenerator _generator;
+
+public:
+    // 构造函数
+    explicit MazeGenerator(unsigned int seed = std::random_device{}())
+        : _generator(static_cast<int>(N), static_cast<int>(N), seed)
+    {
+    }
+
+    // 生成迷宫
+    [[nodiscard]] std::array<std::array<char, N>, N> generate(Position& start, Position& end)
+    {
+        return _generator.generate(start, end).to_array<N>();
+    }
+
+    // 设置随机种子
+    void set_seed(unsigned int seed) { _generator.set_seed(seed); }
+};
+
 #endif // MAZE_GENERATOR_HPP
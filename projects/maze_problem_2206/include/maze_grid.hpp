@@ -0,0 +1,143 @@
+#ifndef MAZE_GRID_HPP
+#define MAZE_GRID_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "position.hpp"
+
+// 运行期大小的迷宫网格（可以是长方形）
+//
+// 所有格子放在一块连续的缓冲区中，按行存放；每行补齐到缓存行大小的整数倍，
+// 缓冲区按缓存行对齐，因此每一行都从缓存行的开头开始。补齐的部分填充为墙（'#'）
+class MazeGrid
+{
+public:
+    static constexpr std::size_t ALIGNMENT = 64; // 缓存行大小
+
+private:
+    // 对齐分配的缓冲区用对应的 operator delete[] 释放
+    struct AlignedDelete
+    {
+        void operator()(char* data) const noexcept
+        {
+            ::operator delete[](data, std::align_val_t{ALIGNMENT});
+        }
+    };
+
+    int _rows = 0;
+    int _cols = 0;
+    std::size_t _stride = 0; // 每行占用的字节数（含补齐）
+    std::unique_ptr<char[], AlignedDelete> _data;
+
+    [[nodiscard]] std::size_t size_in_bytes() const noexcept
+    {
+        return static_cast<std::size_t>(_rows) * _stride;
+    }
+
+public:
+    MazeGrid() = default;
+
+    // 构造函数（所有格子填充为 fill）
+    MazeGrid(int rows, int cols, char fill = '#')
+        : _rows(rows), _cols(cols),
+          _stride((static_cast<std::size_t>(cols) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT),
+          _data(static_cast<char*>(::operator new[](std::max<std::size_t>(size_in_bytes(), 1),
+                                                    std::align_val_t{ALIGNMENT})))
+    {
+        std::fill_n(_data.get(), size_in_bytes(), '#');
+        this->fill(fill);
+    }
+
+    // 从固定大小的二维数组构造
+    template <std::size_t N>
+    explicit MazeGrid(const std::array<std::array<char, N>, N>& grid)
+        : MazeGrid(static_cast<int>(N), static_cast<int>(N))
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            std::copy(grid[i].begin(), grid[i].end(), (*this)[static_cast<int>(i)]);
+        }
+    }
+
+    MazeGrid(const MazeGrid& other) : MazeGrid(other._rows, other._cols)
+    {
+        std::copy_n(other._data.get(), size_in_bytes(), _data.get());
+    }
+
+    MazeGrid& operator=(const MazeGrid& other)
+    {
+        if (this != &other)
+        {
+            *this = MazeGrid(other);
+        }
+        return *this;
+    }
+
+    // 移动后原对象变为 0x0 的空网格
+    MazeGrid(MazeGrid&& other) noexcept
+        : _rows(std::exchange(other._rows, 0)), _cols(std::exchange(other._cols, 0)),
+          _stride(std::exchange(other._stride, 0)), _data(std::move(other._data))
+    {
+    }
+
+    MazeGrid& operator=(MazeGrid&& other) noexcept
+    {
+        _rows = std::exchange(other._rows, 0);
+        _cols = std::exchange(other._cols, 0);
+        _stride = std::exchange(other._stride, 0);
+        _data = std::move(other._data);
+        return *this;
+    }
+
+    [[nodiscard]] int rows() const noexcept { return _rows; }
+    [[nodiscard]] int cols() const noexcept { return _cols; }
+    [[nodiscard]] std::size_t stride() const noexcept { return _stride; }
+
+    // 检查位置是否在网格内
+    [[nodiscard]] bool is_valid(const Position& pos) const noexcept
+    {
+        return pos.row >= 0 && pos.row < _rows && pos.col >= 0 && pos.col < _cols;
+    }
+
+    // 行首指针，grid[row][col] 访问单个格子
+    [[nodiscard]] char* operator[](int row) noexcept
+    {
+        return _data.get() + static_cast<std::size_t>(row) * _stride;
+    }
+
+    [[nodiscard]] const char* operator[](int row) const noexcept
+    {
+        return _data.get() + static_cast<std::size_t>(row) * _stride;
+    }
+
+    [[nodiscard]] char& at(const Position& pos) noexcept { return (*this)[pos.row][pos.col]; }
+    [[nodiscard]] char at(const Position& pos) const noexcept { return (*this)[pos.row][pos.col]; }
+
+    // 所有格子填充为同一个字符（不改变补齐部分）
+    void fill(char value)
+    {
+        for (int row = 0; row < _rows; ++row)
+        {
+            std::fill_n((*this)[row], _cols, value);
+        }
+    }
+
+    // 转换为固定大小的二维数组（N 必须等于行数和列数）
+    template <std::size_t N>
+    [[nodiscard]] std::array<std::array<char, N>, N> to_array() const
+    {
+        std::array<std::array<char, N>, N> grid{};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            std::copy_n((*this)[static_cast<int>(i)], N, grid[i].begin());
+        }
+        return grid;
+    }
+};
+
+#endif // MAZE_GRID_HPP
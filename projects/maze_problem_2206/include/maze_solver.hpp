@@ -0,0 +1,229 @@
+#ifndef MAZE_SOLVER_HPP
+#define MAZE_SOLVER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "bit_grid.hpp"
+#include "position.hpp"
+#include "ring_frontier.hpp"
+
+// 最短路径算法
+enum class SolveAlgorithm
+{
+    BFS = 0,               // 广度优先搜索
+    A_STAR = 1,            // A*（曼哈顿距离启发）
+    BIDIRECTIONAL_BFS = 2, // 双向广度优先搜索
+    BIT_BFS = 3            // 位并行广度优先搜索（一个字同时处理64个格子）
+};
+
+// 算法名称
+[[nodiscard]] constexpr std::string_view to_string(SolveAlgorithm algorithm) noexcept
+{
+    switch (algorithm)
+    {
+    case SolveAlgorithm::BFS:
+        return "广度优先搜索";
+    case SolveAlgorithm::A_STAR:
+        return "A*";
+    case SolveAlgorithm::BIDIRECTIONAL_BFS:
+        return "双向广度优先搜索";
+    case SolveAlgorithm::BIT_BFS:
+        return "位并行广度优先搜索";
+    }
+    return "未知";
+}
+
+// 求解结果和统计
+struct SolveResult
+{
+    bool found = false;
+    std::vector<Position> path;          // 从起点到终点（包含两端），未找到时为空
+    std::size_t expanded = 0;            // 展开（出队）的格子数
+    std::size_t maxFrontier = 0;         // 队列 / 开放表的最大长度
+    std::chrono::nanoseconds elapsed{};  // 求解用时
+};
+
+// 求解过程的观察者
+// 默认什么都不做；需要动画演示或额外统计时派生并传给求解函数，批量求解时传 nullptr
+class SolveObserver
+{
+public:
+    virtual ~SolveObserver() = default;
+
+    // 展开一个格子
+    virtual void on_expand(const Position& /*pos*/) {}
+
+    // 回溯离开一个格子（只有右手法则和DFS会回溯）
+    virtual void on_backtrack(const Position& /*pos*/) {}
+
+    // 找到路径
+    virtual void on_path(const std::vector<Position>& /*path*/) {}
+};
+
+// 最短路径求解器
+//
+// 格子按行优先编号（row * cols + col），工作数组和队列只分配一次，多次求解时重复使用。
+// 前驱只记录“从哪个方向走过来”（每格1字节），各算法的工作数组在第一次用到时分配。
+// 位并行BFS只用位网格：墙、已访问、距离 mod 3（2位）和下一层，每格共5位
+// passable 是 bool(const Position&) 的可调用对象，只会对范围内的位置调用。
+// 求解过程不做任何输出，动画通过 SolveObserver 按需加入
+class MazeSolver
+{
+private:
+    static constexpr int NONE = -1;
+    static constexpr std::uint8_t UNVISITED = 0; // 未访问
+    static constexpr std::uint8_t ROOT = 0xFF;   // 搜索的起点（没有前驱）
+
+    // 四个方向的偏移量（上、右、下、左）
+    static constexpr std::array<Position, 4> _directions = {{{-1, 0}, {0, 1}, {1, 0}, {0, -1}}};
+
+    int _rows;
+    int _cols;
+    std::vector<std::uint8_t> _parent;     // 走到该格的方向编号 + 1，UNVISITED / ROOT 见上
+    std::vector<std::uint8_t> _parentBack; // 双向搜索中反向一侧的前驱
+    std::vector<int> _cost;       // 到起点的距离（A* 的 g 值）
+    std::vector<int> _costBack;   // 双向搜索中到终点的距离
+
+    // A* 开放表中的一项
+    struct OpenNode
+    {
+        int f;
+        int g;
+        int index;
+
+        // 堆顶取最大值：f 小的优先，f 相同时 g 大的（离终点近的）优先
+        bool operator<(const OpenNode& other) const noexcept
+        {
+            return f != other.f ? f > other.f : g < other.g;
+        }
+    };
+
+    RingFrontier<int> _frontier;     // BFS 队列（双向搜索中正向一侧）
+    RingFrontier<int> _frontierBack; // 双向搜索中反向一侧的队列
+    std::vector<OpenNode> _open;     // A* 开放表（二叉堆）
+
+    // 位并行BFS的工作数据
+    BitGrid _wallBits;                      // 由 passable 生成的墙（没有直接传入墙的位网格时使用）
+    BitGrid _visitedBits;                   // 已访问
+    BitGrid _layerLow;                      // 距离 mod 3 的低位
+    BitGrid _layerHigh;                     // 距离 mod 3 的高位
+    BitGrid _nextBits;                      // 正在生成的下一层（每层结束时清零）
+    std::vector<std::size_t> _activeWords;  // 当前层中非零的字
+    std::vector<std::uint64_t> _activeBits; // 当前层这些字中的格子
+    std::vector<std::size_t> _nextWords;    // 下一层中非零的字
+    RingFrontier<std::size_t> _wordQueue;   // 连通性检测中待处理的字
+
+    [[nodiscard]] bool is_valid(const Position& pos) const noexcept
+    {
+        return pos.row >= 0 && pos.row < _rows && pos.col >= 0 && pos.col < _cols;
+    }
+
+    [[nodiscard]] int index_of(const Position& pos) const noexcept
+    {
+        return pos.row * _cols + pos.col;
+    }
+
+    [[nodiscard]] Position position_of(int index) const noexcept
+    {
+        return {index / _cols, index % _cols};
+    }
+
+    // 格子总数
+    [[nodiscard]] std::size_t cell_count() const noexcept
+    {
+        return static_cast<std::size_t>(_rows) * static_cast<std::size_t>(_cols);
+    }
+
+    // 前驱格子（parent 中记录的方向反着走一步）
+    [[nodiscard]] int predecessor_of(const std::vector<std::uint8_t>& parent,
+                                     int index) const noexcept
+    {
+        const Position& dir = _directions[parent[index] - 1];
+        return index - dir.row * _cols - dir.col;
+    }
+
+    // 沿前驱回到起点，得到起点到 index 的路径
+    [[nodiscard]] std::vector<Position> trace_back(const std::vector<std::uint8_t>& parent,
+                                                   int index) const;
+
+    template <typename Passable>
+    void breadth_first(int start, int end, Passable& passable, SolveObserver* observer,
+                       SolveResult& result);
+
+    template <typename Passable>
+    void a_star(int start, int end, Passable& passable, SolveObserver* observer,
+                SolveResult& result);
+
+    template <typename Passable>
+    void bidirectional(int start, int end, Passable& passable, SolveObserver* observer,
+                       SolveResult& result);
+
+    void bit_breadth_first(const BitGrid& walls, Position start, Position end,
+                           SolveObserver* observer, SolveResult& result);
+
+    // 位并行BFS和连通性检测共用的工作位网格
+    void prepare_bits();
+
+    // 墙的位网格必须与求解器大小相同（字级访问按求解器的行数和每行字数进行）
+    void check_walls(const BitGrid& walls) const;
+
+    // 同一个字内，把 seeds 沿 open 中连续的1向两侧扩展（seeds 必须是 open 的子集）
+    [[nodiscard]] static constexpr std::uint64_t fill_runs(std::uint64_t seeds,
+                                                           std::uint64_t open) noexcept
+    {
+        std::uint64_t up = seeds;
+        std::uint64_t upOpen = open;
+        std::uint64_t down = seeds;
+        std::uint64_t downOpen = open;
+        for (int shift = 1; shift < BitGrid::WORD_BITS; shift *= 2)
+        {
+            up |= upOpen & (up << shift);
+            upOpen &= upOpen << shift;
+            down |= downOpen & (down >> shift);
+            downOpen &= downOpen >> shift;
+        }
+        return up | down;
+    }
+
+    // 位并行BFS中格子的距离 mod 3
+    [[nodiscard]] int layer_of(const Position& pos) const noexcept
+    {
+        return (_layerLow.test(pos) ? 1 : 0) | (_layerHigh.test(pos) ? 2 : 0);
+    }
+
+    // 记录用时并通知观察者
+    void finish(SolveResult& result, std::chrono::steady_clock::time_point begin,
+                SolveObserver* observer) const;
+
+public:
+    // 构造函数（工作数组在第一次用到时分配）
+    MazeSolver(int rows, int cols);
+
+    // 求从 start 到 end 的最短路径（四连通，每步代价为1）
+    template <typename Passable>
+    [[nodiscard]] SolveResult solve(SolveAlgorithm algorithm, Position start, Position end,
+                                    Passable passable, SolveObserver* observer = nullptr);
+
+    // 位并行BFS，墙直接由位网格给出（大小与求解器相同，补齐部分必须是墙）
+    // 大小不同时抛出 std::invalid_argument
+    [[nodiscard]] SolveResult solve(const BitGrid& walls, Position start, Position end,
+                                    SolveObserver* observer = nullptr);
+
+    // 从 start 出发能到达的所有格子（不求距离）
+    // 一个字内连续的可通行格子一次扩展完，开阔区域中一次位运算处理64个格子。
+    // 返回的位网格属于求解器，下一次求解时会被覆盖；walls 的大小要求同上
+    [[nodiscard]] const BitGrid& reachable(const BitGrid& walls, Position start);
+
+    [[nodiscard]] int rows() const noexcept { return _rows; }
+    [[nodiscard]] int cols() const noexcept { return _cols; }
+};
+
+// 由于包含模板成员，需要在头文件中包含实现
+#include "../src/maze_solver.tpp"
+
+#endif // MAZE_SOLVER_HPP
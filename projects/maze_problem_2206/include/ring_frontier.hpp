@@ -0,0 +1,85 @@
+#ifndef RING_FRONTIER_HPP
+#define RING_FRONTIER_HPP
+
+#include <cstddef>
+#include <vector>
+
+// 广度优先搜索的队列（环形缓冲区）
+//
+// 容量是2的幂，下标用按位与回绕；满了才按两倍扩容，clear() 不释放内存。
+// 作为成员在多次搜索之间重复使用时，容量到达峰值后就不再分配内存
+template <typename T>
+class RingFrontier
+{
+private:
+    std::vector<T> _buffer;
+    std::size_t _head = 0; // 队首下标
+    std::size_t _size = 0;
+
+    // 扩容到 capacity（2的幂），元素按队列顺序搬到新缓冲区的开头
+    void grow(std::size_t capacity)
+    {
+        std::vector<T> buffer(capacity);
+        for (std::size_t i = 0; i < _size; ++i)
+        {
+            buffer[i] = _buffer[(_head + i) & (_buffer.size() - 1)];
+        }
+        _buffer.swap(buffer);
+        _head = 0;
+    }
+
+public:
+    RingFrontier() = default;
+
+    explicit RingFrontier(std::size_t capacity) { reserve(capacity); }
+
+    // 预留至少 capacity 个元素的空间
+    void reserve(std::size_t capacity)
+    {
+        std::size_t rounded = 16;
+        while (rounded < capacity)
+        {
+            rounded *= 2;
+        }
+        if (rounded > _buffer.size())
+        {
+            grow(rounded);
+        }
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+    [[nodiscard]] std::size_t size() const noexcept { return _size; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return _buffer.size(); }
+
+    // 清空（保留容量）
+    void clear() noexcept
+    {
+        _head = 0;
+        _size = 0;
+    }
+
+    // 入队
+    void push(const T& value)
+    {
+        if (_size == _buffer.size())
+        {
+            grow(_buffer.empty() ? 16 : _buffer.size() * 2);
+        }
+        _buffer[(_head + _size) & (_buffer.size() - 1)] = value;
+        ++_size;
+    }
+
+    // 队首元素
+    [[nodiscard]] const T& front() const noexcept { return _buffer[_head]; }
+
+    // 出队并返回队首元素
+    T pop() noexcept
+    {
+        const T value = _buffer[_head];
+        _head = (_head + 1) & (_buffer.size() - 1);
+        --_size;
+        return value;
+    }
+};
+
+#endif // RING_FRONTIER_HPP
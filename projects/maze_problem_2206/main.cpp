@@ -1,11 +1,74 @@
 #include <array>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
+#include <string_view>
 
 #include "include/maze.hpp"
 #include "include/maze_generator.hpp"
 
-int main()
+// 批量模式：生成若干随机迷宫，用各种最短路径算法求解并核对路径长度，不做任何渲染
+int run_batch(int count, int rows, int cols)
 {
+    constexpr std::array<SolveAlgorithm, 4> algorithms = {
+        SolveAlgorithm::BFS, SolveAlgorithm::A_STAR, SolveAlgorithm::BIDIRECTIONAL_BFS,
+        SolveAlgorithm::BIT_BFS};
+
+    DynamicMazeGenerator generator(rows, cols, 2206);
+    MazeSolver solver(rows, cols);
+    std::array<std::chrono::nanoseconds, algorithms.size()> elapsed{};
+    std::array<std::size_t, algorithms.size()> expanded{};
+    int mismatches = 0;
+
+    for (int i = 0; i < count; ++i)
+    {
+        Position start{};
+        Position end{};
+        DynamicMaze maze(generator.generate(start, end), start, end);
+
+        std::size_t length = 0;
+        for (std::size_t a = 0; a < algorithms.size(); ++a)
+        {
+            const SolveResult result = maze.find_path(solver, algorithms[a]);
+            elapsed[a] += result.elapsed;
+            expanded[a] += result.expanded;
+            if (!result.found || (a > 0 && result.path.size() != length))
+            {
+                ++mismatches;
+            }
+            length = result.path.size();
+        }
+    }
+
+    std::cout << "批量求解 " << count << " 个 " << rows << "x" << cols << " 迷宫:\n";
+    for (std::size_t a = 0; a < algorithms.size(); ++a)
+    {
+        std::cout << "  " << to_string(algorithms[a]) << ": 平均展开 "
+                  << expanded[a] / static_cast<std::size_t>(count) << " 格, 平均用时 "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(elapsed[a]).count() /
+                         count
+                  << " 微秒\n";
+    }
+    std::cout << "路径长度不一致或无解: " << mismatches << "\n";
+    return mismatches == 0 ? 0 : 1;
+}
+
+int main(int argc, char* argv[])
+{
+    // 用法: maze_problem_2206 --batch [数量] [行数] [列数]
+    if (argc > 1 && std::string_view(argv[1]) == "--batch")
+    {
+        const int count = argc > 2 ? std::atoi(argv[2]) : 100;
+        const int rows = argc > 3 ? std::atoi(argv[3]) : 63;
+        const int cols = argc > 4 ? std::atoi(argv[4]) : rows;
+        if (count <= 0 || rows < 3 || cols < 3)
+        {
+            std::cerr << "用法: " << argv[0] << " --batch [数量] [行数] [列数]\n";
+            return 1;
+        }
+        return run_batch(count, rows, cols);
+    }
+
     std::array<std::array<char, 12>, 12> mazeGrid{};
     Position start{};
     Position end{};
@@ -56,13 +119,38 @@ int main()
     std::cout << "\n选择遍历算法:\n";
     std::cout << "1. 右手法则（靠右墙行走）\n";
     std::cout << "2. 深度优先搜索（DFS）\n";
-    std::cout << "请输入选项 (1 或 2): ";
+    std::cout << "3. 广度优先搜索（BFS，最短路径）\n";
+    std::cout << "4. A*（曼哈顿距离，最短路径）\n";
+    std::cout << "5. 双向广度优先搜索（最短路径）\n";
+    std::cout << "6. 位并行广度优先搜索（最短路径）\n";
+    std::cout << "请输入选项 (1-6): ";
 
     int choice;
     std::cin >> choice;
 
-    bool useRightHand = (choice == 1);
-    maze.solve(useRightHand);
+    if (choice >= 3 && choice <= 6)
+    {
+        const auto algorithm = static_cast<SolveAlgorithm>(choice - 3);
+        std::cout << "\n算法: " << to_string(algorithm) << "\n";
+
+        MazeAnimation animation(maze, std::chrono::milliseconds(150));
+        const SolveResult result = maze.find_path(algorithm, &animation);
+        if (result.found)
+        {
+            std::cout << "\n找到最短路径！路径长度: " << result.path.size() - 1
+                      << " 步, 展开格子数: " << result.expanded
+                      << ", 最大队列长度: " << result.maxFrontier << "\n";
+        }
+        else
+        {
+            std::cout << "\n未找到出口。\n";
+        }
+    }
+    else
+    {
+        bool useRightHand = (choice == 1);
+        maze.solve(useRightHand);
+    }
 
     std::cout << "\n图例:\n";
     std::cout << "  # - 墙壁\n";
@@ -71,6 +159,7 @@ int main()
     std::cout << "  E - 终点\n";
     std::cout << "  X - 探索的路径\n";
     std::cout << "  o - 回溯的路径\n";
+    std::cout << "  * - 最短路径\n";
 
     return 0;
 }
\ No newline at end of file
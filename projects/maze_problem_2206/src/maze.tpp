@@ -1,51 +1,72 @@
 #ifndef MAZE_TPP
 #define MAZE_TPP
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
+#include <stdexcept>
 #include <thread>
+#include <utility>
 
 using namespace std::chrono_literals;
 
 // 构造函数实现
-template <std::size_t N>
-Maze<N>::Maze(const std::array<std::array<char, N>, N>& grid, Position start, Position end)
-    : _grid(grid), _start(start), _end(end)
+inline DynamicMaze::DynamicMaze(MazeGrid grid, Position start, Position end)
+    : _grid(std::move(grid)), _walls(_grid.rows(), _grid.cols(), true), _start(start), _end(end)
 {
+    for (int row = 0; row < _grid.rows(); ++row)
+    {
+        for (int col = 0; col < _grid.cols(); ++col)
+        {
+            if (_grid[row][col] != '#')
+            {
+                _walls.reset({row, col});
+            }
+        }
+    }
+    mark(_start, 'S');
+    mark(_end, 'E');
 }
 
 // 检查位置是否有效
-template <std::size_t N>
-bool Maze<N>::is_valid(const Position& pos) const noexcept
+inline bool DynamicMaze::is_valid(const Position& pos) const noexcept
 {
-    return pos.row >= 0 && pos.row < static_cast<int>(N) && pos.col >= 0 &&
-           pos.col < static_cast<int>(N);
+    return _grid.is_valid(pos);
 }
 
 // 检查位置是否可以访问
-template <std::size_t N>
-bool Maze<N>::can_visit(const Position& pos) const noexcept
+inline bool DynamicMaze::can_visit(const Position& pos) const noexcept
 {
     return is_valid(pos) && (_grid[pos.row][pos.col] == '.' || _grid[pos.row][pos.col] == 'E');
 }
 
+// 检查位置是否不是墙
+inline bool DynamicMaze::is_open(const Position& pos) const noexcept
+{
+    return is_valid(pos) && !_walls.test(pos);
+}
+
 // 打印迷宫
-template <std::size_t N>
-void Maze<N>::display() const
+inline void DynamicMaze::display() const
+{
+    display(_steps);
+}
+
+inline void DynamicMaze::display(int step) const
 {
-    std::cout << "\n步骤 " << _steps << ":\n";
+    std::cout << "\n步骤 " << step << ":\n";
     std::cout << "   "; // 3个空格对齐
-    for (std::size_t i = 0; i < N; ++i)
+    for (int i = 0; i < _grid.cols(); ++i)
     {
         std::cout << std::setw(2) << std::setfill('0') << i << " ";
     }
     std::cout << "\n";
 
-    for (std::size_t i = 0; i < N; ++i)
+    for (int i = 0; i < _grid.rows(); ++i)
     {
         std::cout << std::setw(2) << std::setfill('0') << i << " ";
-        for (std::size_t j = 0; j < N; ++j)
+        for (int j = 0; j < _grid.cols(); ++j)
         {
             std::cout << std::setw(2) << std::setfill(' ') << _grid[i][j] << " ";
         }
@@ -55,118 +76,155 @@ void Maze<N>::display() const
 }
 
 // 标记位置
-template <std::size_t N>
-void Maze<N>::mark(const Position& pos, char marker)
+inline void DynamicMaze::mark(const Position& pos, char marker)
 {
     if (is_valid(pos) && _grid[pos.row][pos.col] != 'S' && _grid[pos.row][pos.col] != 'E')
     {
         _grid[pos.row][pos.col] = marker;
+        if (marker == '#')
+        {
+            _walls.set(pos);
+        }
+        else
+        {
+            _walls.reset(pos);
+        }
+    }
+}
+
+// 标记整条路径（起点和终点保持不变）
+inline void DynamicMaze::mark_path(const std::vector<Position>& path, char marker)
+{
+    for (const auto& pos : path)
+    {
+        mark(pos, marker);
     }
 }
 
 // 获取字符
-template <std::size_t N>
-char Maze<N>::get_char(const Position& pos) const
+inline char DynamicMaze::get_char(const Position& pos) const
 {
     return is_valid(pos) ? _grid[pos.row][pos.col] : '#';
 }
 
-// 右手法则遍历（递归实现）
-template <std::size_t N>
-bool Maze<N>::traverse_right_hand(Position current, Direction facing)
+// 通知观察者
+inline void DynamicMaze::notify_expand(const Position& pos)
+{
+    if (_observer != nullptr)
+    {
+        _observer->on_expand(pos);
+    }
+}
+
+inline void DynamicMaze::notify_backtrack(const Position& pos)
+{
+    if (_observer != nullptr)
+    {
+        _observer->on_backtrack(pos);
+    }
+}
+
+// 进入一个格子：计步、标记、通知观察者，返回是否到达终点
+inline bool DynamicMaze::enter(const Position& pos)
 {
     _steps++;
+    mark(pos, 'X');
+    notify_expand(pos);
+    return pos == _end;
+}
 
-    // 到达终点
-    if (current == _end)
+// 回溯离开栈顶的格子
+inline void DynamicMaze::leave()
+{
+    const Position current = _stack.back().pos;
+    _stack.pop_back();
+    mark(current, 'o');
+    notify_backtrack(current);
+}
+
+// 右手法则遍历（显式栈实现，访问顺序与递归写法相同）
+inline bool DynamicMaze::traverse_right_hand(Position current, Direction facing)
+{
+    _stack.clear();
+    if (enter(current))
     {
-        mark(current, 'X');
-        display();
-        std::this_thread::sleep_for(300ms);
         return true;
     }
+    _stack.push_back({current, facing, 0});
 
-    // 标记当前位置
-    mark(current, 'X');
-    display();
-    std::this_thread::sleep_for(300ms);
+    while (!_stack.empty())
+    {
+        TraverseFrame& frame = _stack.back();
+        if (frame.next == 4)
+        {
+            leave();
+            continue;
+        }
 
-    // 右手法则：优先尝试右转，然后直行，然后左转，最后后退
-    // 按照面向方向，计算右、前、左、后的方向
-    std::array<Direction, 4> tryOrder = {{
-        static_cast<Direction>((static_cast<int>(facing) + 1) % 4), // 右
-        facing,                                                     // 前
-        static_cast<Direction>((static_cast<int>(facing) + 3) % 4), // 左
-        static_cast<Direction>((static_cast<int>(facing) + 2) % 4)  // 后
-    }};
+        // 右手法则：优先尝试右转，然后直行，然后左转，最后后退
+        // 依次对应面向方向 +1、+0、+3、+2（模4）
+        constexpr std::array<int, 4> turns = {1, 0, 3, 2};
+        const auto dir =
+            static_cast<Direction>((static_cast<int>(frame.facing) + turns[frame.next]) % 4);
+        ++frame.next;
 
-    for (Direction dir : tryOrder)
-    {
-        Position next = {current.row + _directions[static_cast<int>(dir)].row,
-                         current.col + _directions[static_cast<int>(dir)].col};
+        Position next = {frame.pos.row + _directions[static_cast<int>(dir)].row,
+                         frame.pos.col + _directions[static_cast<int>(dir)].col};
 
         if (can_visit(next))
         {
-            if (traverse_right_hand(next, dir))
+            if (enter(next))
             {
                 return true;
             }
+            _stack.push_back({next, dir, 0});
         }
     }
 
-    // 回溯
-    mark(current, 'o');
-    display();
-    std::this_thread::sleep_for(200ms);
     return false;
 }
 
-// DFS遍历（深度优先搜索）
-template <std::size_t N>
-bool Maze<N>::traverse_dfs(Position current)
+// DFS遍历（深度优先搜索，显式栈实现，访问顺序与递归写法相同）
+inline bool DynamicMaze::traverse_dfs(Position current)
 {
-    _steps++;
-
-    // 到达终点
-    if (current == _end)
+    _stack.clear();
+    if (enter(current))
     {
-        mark(current, 'X');
-        display();
-        std::this_thread::sleep_for(300ms);
         return true;
     }
+    _stack.push_back({current, Direction::UP, 0});
 
-    // 标记当前位置
-    mark(current, 'X');
-    display();
-    std::this_thread::sleep_for(300ms);
-
-    // 尝试四个方向（上、右、下、左）
-    for (const auto& dir : _directions)
+    while (!_stack.empty())
     {
-        Position next = {current.row + dir.row, current.col + dir.col};
+        TraverseFrame& frame = _stack.back();
+        if (frame.next == 4)
+        {
+            leave();
+            continue;
+        }
+
+        // 尝试四个方向（上、右、下、左）
+        const Position& dir = _directions[frame.next];
+        ++frame.next;
+
+        Position next = {frame.pos.row + dir.row, frame.pos.col + dir.col};
 
         if (can_visit(next))
         {
-            if (traverse_dfs(next))
+            if (enter(next))
             {
                 return true;
             }
+            _stack.push_back({next, Direction::UP, 0});
         }
     }
 
-    // 回溯
-    mark(current, 'o');
-    display();
-    std::this_thread::sleep_for(200ms);
     return false;
 }
 
-// 开始遍历
-template <std::size_t N>
-bool Maze<N>::solve(bool useRightHand)
+// 开始遍历（带动画演示和输出）
+inline bool DynamicMaze::solve(bool useRightHand)
 {
-    _steps = 0;
     mark(_start, 'S');
     mark(_end, 'E');
 
@@ -175,9 +233,41 @@ bool Maze<N>::solve(bool useRightHand)
     std::cout << "终点: (" << _end.row << ", " << _end.col << ")\n";
     std::cout << "算法: " << (useRightHand ? "右手法则" : "深度优先搜索") << "\n";
 
-    display();
+    display(0);
     std::this_thread::sleep_for(1s);
 
+    MazeAnimation animation(*this);
+    bool result = solve(useRightHand, &animation);
+
+    if (result)
+    {
+        std::cout << "\n成功找到出口！总步数: " << _steps << "\n";
+    }
+    else
+    {
+        std::cout << "\n未找到出口。\n";
+    }
+
+    return result;
+}
+
+// 开始遍历（不输出）
+inline bool DynamicMaze::solve(bool useRightHand, SolveObserver* observer)
+{
+    _steps = 0;
+    _observer = observer;
+    mark(_start, 'S');
+    mark(_end, 'E');
+
+    // 栈深度不超过可通行的格子数
+    std::size_t openCells = 0;
+    for (int row = 0; row < _grid.rows(); ++row)
+    {
+        openCells += static_cast<std::size_t>(
+            std::count_if(_grid[row], _grid[row] + _grid.cols(), [](char c) { return c != '#'; }));
+    }
+    _stack.reserve(openCells);
+
     bool result;
     if (useRightHand)
     {
@@ -188,16 +278,53 @@ bool Maze<N>::solve(bool useRightHand)
         result = traverse_dfs(_start);
     }
 
-    if (result)
+    _observer = nullptr;
+    return result;
+}
+
+// 求最短路径
+inline SolveResult DynamicMaze::find_path(SolveAlgorithm algorithm,
+                                          SolveObserver* observer) const
+{
+    MazeSolver solver(_grid.rows(), _grid.cols());
+    return find_path(solver, algorithm, observer);
+}
+
+// 求最短路径（solver 的大小必须与迷宫相同，否则抛出 std::invalid_argument）
+inline SolveResult DynamicMaze::find_path(MazeSolver& solver, SolveAlgorithm algorithm,
+                                          SolveObserver* observer) const
+{
+    if (solver.rows() != _grid.rows() || solver.cols() != _grid.cols())
     {
-        std::cout << "\n成功找到出口！总步数: " << _steps << "\n";
+        throw std::invalid_argument("求解器的大小与迷宫不同");
     }
-    else
+    if (algorithm == SolveAlgorithm::BIT_BFS)
     {
-        std::cout << "\n未找到出口。\n";
+        return solver.solve(_walls, _start, _end, observer);
     }
+    return solver.solve(
+        algorithm, _start, _end, [this](const Position& pos) { return is_open(pos); }, observer);
+}
 
-    return result;
+// 动画：标记、重绘、暂停
+inline void MazeAnimation::on_expand(const Position& pos)
+{
+    _maze.mark(pos, 'X');
+    _maze.display(++_steps);
+    std::this_thread::sleep_for(_delay);
+}
+
+inline void MazeAnimation::on_backtrack(const Position& pos)
+{
+    _maze.mark(pos, 'o');
+    _maze.display(_steps);
+    std::this_thread::sleep_for(_delay * 2 / 3);
+}
+
+inline void MazeAnimation::on_path(const std::vector<Position>& path)
+{
+    _maze.mark_path(path);
+    _maze.display(_steps);
 }
 
 #endif // MAZE_TPP
@@ -0,0 +1,504 @@
+#ifndef MAZE_SOLVER_TPP
+#define MAZE_SOLVER_TPP
+
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <cstdlib>
+#include <stdexcept>
+
+// 构造函数实现
+inline MazeSolver::MazeSolver(int rows, int cols) : _rows(rows), _cols(cols) {}
+
+// 记录用时并通知观察者
+inline void MazeSolver::finish(SolveResult& result, std::chrono::steady_clock::time_point begin,
+                               SolveObserver* observer) const
+{
+    result.found = !result.path.empty();
+    result.elapsed = std::chrono::steady_clock::now() - begin;
+    if (result.found && observer != nullptr)
+    {
+        observer->on_path(result.path);
+    }
+}
+
+// 沿前驱回到起点
+inline std::vector<Position> MazeSolver::trace_back(const std::vector<std::uint8_t>& parent,
+                                                    int index) const
+{
+    std::vector<Position> path;
+    while (true)
+    {
+        path.push_back(position_of(index));
+        if (parent[index] == ROOT)
+        {
+            break;
+        }
+        index = predecessor_of(parent, index);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+// 求解入口
+template <typename Passable>
+SolveResult MazeSolver::solve(SolveAlgorithm algorithm, Position start, Position end,
+                              Passable passable, SolveObserver* observer)
+{
+    const auto begin = std::chrono::steady_clock::now();
+    SolveResult result;
+
+    if (is_valid(start) && is_valid(end) && passable(start) && passable(end))
+    {
+        if (algorithm != SolveAlgorithm::BIT_BFS)
+        {
+            _parent.assign(cell_count(), UNVISITED);
+        }
+        if (algorithm == SolveAlgorithm::A_STAR || algorithm == SolveAlgorithm::BIDIRECTIONAL_BFS)
+        {
+            _cost.assign(cell_count(), INT_MAX);
+        }
+
+        switch (algorithm)
+        {
+        case SolveAlgorithm::BFS:
+            breadth_first(index_of(start), index_of(end), passable, observer, result);
+            break;
+        case SolveAlgorithm::A_STAR:
+            a_star(index_of(start), index_of(end), passable, observer, result);
+            break;
+        case SolveAlgorithm::BIDIRECTIONAL_BFS:
+            _parentBack.assign(cell_count(), UNVISITED);
+            _costBack.assign(cell_count(), INT_MAX);
+            bidirectional(index_of(start), index_of(end), passable, observer, result);
+            break;
+        case SolveAlgorithm::BIT_BFS:
+            // 先把 passable 转换为墙的位网格
+            if (_wallBits.rows() != _rows || _wallBits.cols() != _cols)
+            {
+                _wallBits = BitGrid(_rows, _cols, true);
+            }
+            _wallBits.assign(true);
+            for (int row = 0; row < _rows; ++row)
+            {
+                for (int col = 0; col < _cols; ++col)
+                {
+                    if (passable(Position{row, col}))
+                    {
+                        _wallBits.reset({row, col});
+                    }
+                }
+            }
+            bit_breadth_first(_wallBits, start, end, observer, result);
+            break;
+        }
+    }
+
+    finish(result, begin, observer);
+    return result;
+}
+
+// 位并行BFS入口
+inline SolveResult MazeSolver::solve(const BitGrid& walls, Position start, Position end,
+                                     SolveObserver* observer)
+{
+    check_walls(walls);
+    const auto begin = std::chrono::steady_clock::now();
+    SolveResult result;
+
+    if (is_valid(start) && is_valid(end) && !walls.test(start) && !walls.test(end))
+    {
+        bit_breadth_first(walls, start, end, observer, result);
+    }
+
+    finish(result, begin, observer);
+    return result;
+}
+
+// 广度优先搜索：按层展开，第一次到达终点时的路径最短
+template <typename Passable>
+void MazeSolver::breadth_first(int start, int end, Passable& passable, SolveObserver* observer,
+                               SolveResult& result)
+{
+    RingFrontier<int>& frontier = _frontier;
+    frontier.clear();
+    _parent[start] = ROOT;
+    frontier.push(start);
+
+    while (!frontier.empty())
+    {
+        const int current = frontier.pop();
+        ++result.expanded;
+
+        const Position pos = position_of(current);
+        if (observer != nullptr)
+        {
+            observer->on_expand(pos);
+        }
+        if (current == end)
+        {
+            result.path = trace_back(_parent, end);
+            return;
+        }
+
+        for (std::size_t d = 0; d < _directions.size(); ++d)
+        {
+            const Position next = {pos.row + _directions[d].row, pos.col + _directions[d].col};
+            if (!is_valid(next))
+            {
+                continue;
+            }
+            const int nextIndex = index_of(next);
+            if (_parent[nextIndex] == UNVISITED && passable(next))
+            {
+                _parent[nextIndex] = static_cast<std::uint8_t>(d + 1);
+                frontier.push(nextIndex);
+            }
+        }
+        result.maxFrontier = std::max(result.maxFrontier, frontier.size());
+    }
+}
+
+// A*：f = g + 曼哈顿距离
+// 曼哈顿距离在四连通网格上是一致的启发函数，格子第一次出队时的 g 值就是最短距离
+template <typename Passable>
+void MazeSolver::a_star(int start, int end, Passable& passable, SolveObserver* observer,
+                        SolveResult& result)
+{
+    const Position goal = position_of(end);
+    auto heuristic = [&goal](const Position& pos) {
+        return std::abs(pos.row - goal.row) + std::abs(pos.col - goal.col);
+    };
+
+    std::vector<OpenNode>& open = _open;
+    open.clear();
+    _parent[start] = ROOT;
+    _cost[start] = 0;
+    open.push_back({heuristic(position_of(start)), 0, start});
+
+    while (!open.empty())
+    {
+        std::pop_heap(open.begin(), open.end());
+        const OpenNode node = open.back();
+        open.pop_back();
+        if (node.g > _cost[node.index])
+        {
+            continue; // 已经以更小的代价展开过
+        }
+        ++result.expanded;
+
+        const Position pos = position_of(node.index);
+        if (observer != nullptr)
+        {
+            observer->on_expand(pos);
+        }
+        if (node.index == end)
+        {
+            result.path = trace_back(_parent, end);
+            return;
+        }
+
+        for (std::size_t d = 0; d < _directions.size(); ++d)
+        {
+            const Position next = {pos.row + _directions[d].row, pos.col + _directions[d].col};
+            if (!is_valid(next))
+            {
+                continue;
+            }
+            const int nextIndex = index_of(next);
+            const int cost = node.g + 1;
+            if (cost < _cost[nextIndex] && passable(next))
+            {
+                _cost[nextIndex] = cost;
+                _parent[nextIndex] = static_cast<std::uint8_t>(d + 1);
+                open.push_back({cost + heuristic(next), cost, nextIndex});
+                std::push_heap(open.begin(), open.end());
+            }
+        }
+        result.maxFrontier = std::max(result.maxFrontier, open.size());
+    }
+}
+
+// 双向广度优先搜索：从起点和终点同时按层展开，每次展开较小的一侧的一整层
+// 一层中遇到另一侧已访问的格子时记下最短的相遇点，整层展开完再结束（保证路径最短）
+template <typename Passable>
+void MazeSolver::bidirectional(int start, int end, Passable& passable, SolveObserver* observer,
+                               SolveResult& result)
+{
+    RingFrontier<int>& forward = _frontier;
+    RingFrontier<int>& backward = _frontierBack;
+    forward.clear();
+    backward.clear();
+    forward.push(start);
+    backward.push(end);
+    _parent[start] = ROOT;
+    _cost[start] = 0;
+    _parentBack[end] = ROOT;
+    _costBack[end] = 0;
+
+    int meet = start == end ? start : NONE;
+    int best = meet == NONE ? INT_MAX : 0;
+
+    while (meet == NONE && !forward.empty() && !backward.empty())
+    {
+        const bool expandForward = forward.size() <= backward.size();
+        RingFrontier<int>& frontier = expandForward ? forward : backward;
+        std::vector<std::uint8_t>& parent = expandForward ? _parent : _parentBack;
+        std::vector<int>& cost = expandForward ? _cost : _costBack;
+        const std::vector<int>& otherCost = expandForward ? _costBack : _cost;
+
+        // 只展开当前这一层（展开过程中新入队的属于下一层）
+        for (std::size_t remaining = frontier.size(); remaining > 0; --remaining)
+        {
+            const int current = frontier.pop();
+            ++result.expanded;
+            const Position pos = position_of(current);
+            if (observer != nullptr)
+            {
+                observer->on_expand(pos);
+            }
+
+            for (std::size_t d = 0; d < _directions.size(); ++d)
+            {
+                const Position neighbour = {pos.row + _directions[d].row,
+                                            pos.col + _directions[d].col};
+                if (!is_valid(neighbour))
+                {
+                    continue;
+                }
+                const int index = index_of(neighbour);
+                if (parent[index] != UNVISITED || !passable(neighbour))
+                {
+                    continue;
+                }
+                parent[index] = static_cast<std::uint8_t>(d + 1);
+                cost[index] = cost[current] + 1;
+                frontier.push(index);
+
+                if (otherCost[index] != INT_MAX && cost[index] + otherCost[index] < best)
+                {
+                    best = cost[index] + otherCost[index];
+                    meet = index;
+                }
+            }
+        }
+        result.maxFrontier = std::max(result.maxFrontier, forward.size() + backward.size());
+    }
+
+    if (meet == NONE)
+    {
+        return;
+    }
+
+    // 起点 → 相遇点，再沿反向的前驱走到终点
+    result.path = trace_back(_parent, meet);
+    for (int index = meet; _parentBack[index] != ROOT;)
+    {
+        index = predecessor_of(_parentBack, index);
+        result.path.push_back(position_of(index));
+    }
+}
+
+// 位并行BFS和连通性检测共用的工作位网格
+inline void MazeSolver::prepare_bits()
+{
+    if (_visitedBits.rows() != _rows || _visitedBits.cols() != _cols)
+    {
+        _visitedBits = BitGrid(_rows, _cols);
+        _layerLow = BitGrid(_rows, _cols);
+        _layerHigh = BitGrid(_rows, _cols);
+        _nextBits = BitGrid(_rows, _cols); // 每层结束时清零，之后一直保持全0
+    }
+    _visitedBits.assign(false);
+}
+
+// 墙的位网格与求解器大小不同时，按字访问会越界或只覆盖一部分
+inline void MazeSolver::check_walls(const BitGrid& walls) const
+{
+    if (walls.rows() != _rows || walls.cols() != _cols)
+    {
+        throw std::invalid_argument("墙的位网格大小与求解器不同");
+    }
+}
+
+// 连通性检测（字级的洪水填充）
+// 处理一个字时先在字内沿连续的可通行格子扩展，再把新到达的格子传给左右相邻的字和上下两行；
+// 相邻的字有新格子时入队，入队次数不超过格子数
+inline const BitGrid& MazeSolver::reachable(const BitGrid& walls, Position start)
+{
+    check_walls(walls);
+    prepare_bits();
+    if (!is_valid(start) || walls.test(start))
+    {
+        return _visitedBits;
+    }
+
+    const std::size_t stride = walls.words_per_row();
+    auto spread = [&](std::size_t index, std::uint64_t bits) {
+        const std::uint64_t fresh = bits & ~walls.word(index) & ~_visitedBits.word(index);
+        if (fresh != 0)
+        {
+            _visitedBits.word(index) |= fresh;
+            _wordQueue.push(index);
+        }
+    };
+
+    _wordQueue.clear();
+    _visitedBits.set(start);
+    _wordQueue.push(walls.word_index(start));
+
+    while (!_wordQueue.empty())
+    {
+        const std::size_t index = _wordQueue.pop();
+        const std::uint64_t bits = fill_runs(_visitedBits.word(index), ~walls.word(index));
+        _visitedBits.word(index) = bits;
+
+        const std::size_t word = index % stride;
+        if (word > 0)
+        {
+            spread(index - 1, bits << (BitGrid::WORD_BITS - 1));
+        }
+        if (word + 1 < stride)
+        {
+            spread(index + 1, bits >> (BitGrid::WORD_BITS - 1));
+        }
+        if (index >= stride)
+        {
+            spread(index - stride, bits);
+        }
+        if (index + stride < walls.word_count())
+        {
+            spread(index + stride, bits);
+        }
+    }
+
+    return _visitedBits;
+}
+
+// 位并行广度优先搜索
+//
+// 每一层是一组非零的字（同一行中相邻的64个格子），展开一个字时：
+// - 左右邻居是字左移、右移一位（最低位、最高位溢出到相邻的字）
+// - 上下邻居是上一行、下一行同一位置的字
+// 与墙、已访问按位运算后得到新到达的格子，一次处理一个字中所有的格子。
+// 不记录前驱，只记录距离 mod 3：相邻格子的距离最多差1，
+// 从终点出发每次走到距离 mod 3 小1的已访问邻居，就是一条最短路径
+inline void MazeSolver::bit_breadth_first(const BitGrid& walls, Position start, Position end,
+                                          SolveObserver* observer, SolveResult& result)
+{
+    prepare_bits();
+    _layerLow.assign(false);
+    _layerHigh.assign(false);
+
+    const std::size_t stride = walls.words_per_row();
+    const std::size_t lastWord = stride - 1;
+
+    _activeWords.assign(1, walls.word_index(start));
+    _activeBits.assign(1, BitGrid::bit_of(start.col));
+    _visitedBits.set(start);
+
+    // 把 bits 中的格子加入下一层（只保留不是墙、没访问过的）
+    auto reach = [&](std::size_t index, std::uint64_t bits, int layer) {
+        const std::uint64_t fresh = bits & ~walls.word(index) & ~_visitedBits.word(index);
+        if (fresh == 0)
+        {
+            return;
+        }
+        _visitedBits.word(index) |= fresh;
+        if ((layer & 1) != 0)
+        {
+            _layerLow.word(index) |= fresh;
+        }
+        if ((layer & 2) != 0)
+        {
+            _layerHigh.word(index) |= fresh;
+        }
+        if (_nextBits.word(index) == 0)
+        {
+            _nextWords.push_back(index);
+        }
+        _nextBits.word(index) |= fresh;
+    };
+
+    for (int distance = 0; !_activeWords.empty(); ++distance)
+    {
+        // 统计并通知当前层
+        std::size_t layerSize = 0;
+        for (std::size_t i = 0; i < _activeWords.size(); ++i)
+        {
+            layerSize += static_cast<std::size_t>(std::popcount(_activeBits[i]));
+            if (observer != nullptr)
+            {
+                const int row = static_cast<int>(_activeWords[i] / stride);
+                const int base = static_cast<int>(_activeWords[i] % stride) * BitGrid::WORD_BITS;
+                for (std::uint64_t bits = _activeBits[i]; bits != 0; bits &= bits - 1)
+                {
+                    observer->on_expand({row, base + std::countr_zero(bits)});
+                }
+            }
+        }
+        result.expanded += layerSize;
+        result.maxFrontier = std::max(result.maxFrontier, layerSize);
+
+        if (_visitedBits.test(end))
+        {
+            // 终点在当前层：从终点沿距离递减的方向走回起点
+            Position current = end;
+            result.path.assign(1, current);
+            for (int d = distance; d > 0; --d)
+            {
+                for (const auto& dir : _directions)
+                {
+                    const Position prev = {current.row + dir.row, current.col + dir.col};
+                    if (is_valid(prev) && _visitedBits.test(prev) && layer_of(prev) == (d - 1) % 3)
+                    {
+                        current = prev;
+                        break;
+                    }
+                }
+                result.path.push_back(current);
+            }
+            std::reverse(result.path.begin(), result.path.end());
+            return;
+        }
+
+        // 展开当前层
+        const int layer = (distance + 1) % 3;
+        _nextWords.clear();
+        for (std::size_t i = 0; i < _activeWords.size(); ++i)
+        {
+            const std::size_t index = _activeWords[i];
+            const std::uint64_t bits = _activeBits[i];
+            const std::size_t word = index % stride;
+
+            reach(index, bits << 1 | bits >> 1, layer);
+            if (word > 0)
+            {
+                reach(index - 1, bits << (BitGrid::WORD_BITS - 1), layer);
+            }
+            if (word < lastWord)
+            {
+                reach(index + 1, bits >> (BitGrid::WORD_BITS - 1), layer);
+            }
+            if (index >= stride)
+            {
+                reach(index - stride, bits, layer);
+            }
+            if (index + stride < walls.word_count())
+            {
+                reach(index + stride, bits, layer);
+            }
+        }
+
+        // 下一层成为当前层，_nextBits 恢复为全0
+        _activeWords.swap(_nextWords);
+        _activeBits.resize(_activeWords.size());
+        for (std::size_t i = 0; i < _activeWords.size(); ++i)
+        {
+            _activeBits[i] = _nextBits.word(_activeWords[i]);
+            _nextBits.word(_activeWords[i]) = 0;
+        }
+    }
+}
+
+#endif // MAZE_SOLVER_TPP
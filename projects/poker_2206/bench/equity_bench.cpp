@@ -0,0 +1,67 @@
+#include "EquityCalculator.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+// 胜率计算的多线程扩展性基准
+// 对同一手牌用 1 到 64 个线程各模拟固定数量的牌局，输出每秒模拟的牌局数和相对单线程的加速比
+
+namespace {
+
+constexpr std::uint64_t TRIALS = 4'000'000;
+constexpr size_t THREAD_COUNTS[] = {1, 2, 4, 8, 16, 32, 64};
+
+} // namespace
+
+int main() {
+    using namespace Poker;
+
+    // 一对 J：AI 策略会换掉另外3张牌
+    const Hand hero({
+        Card(Suit::Hearts, Rank::Jack),
+        Card(Suit::Spades, Rank::Jack),
+        Card(Suit::Clubs, Rank::Four),
+        Card(Suit::Diamonds, Rank::Seven),
+        Card(Suit::Hearts, Rank::Nine),
+    });
+
+    std::cout << "=== 胜率计算基准 ===\n";
+    std::cout << "手牌:\n" << hero.to_string();
+    std::cout << "硬件线程数: " << std::thread::hardware_concurrency() << "\n\n";
+    std::cout << std::setw(6) << "线程" << std::setw(16) << "牌局/秒" << std::setw(10) << "加速比"
+              << std::setw(10) << "胜率" << "\n";
+
+    double baseline = 0.0;
+    for (size_t threads : THREAD_COUNTS) {
+        EquityOptions options;
+        options.max_trials = TRIALS;
+        options.threads = threads;
+        options.seed = 2206;
+
+        const auto start = std::chrono::steady_clock::now();
+        const EquityResult result = EquityCalculator::calculate(hero, options);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        const double handsPerSecond = static_cast<double>(result.trials) / elapsed.count();
+        if (threads == 1) {
+            baseline = handsPerSecond;
+        }
+
+        std::cout << std::setw(6) << threads << std::setw(16) << std::fixed << std::setprecision(0)
+                  << handsPerSecond << std::setw(10) << std::setprecision(2)
+                  << handsPerSecond / baseline << std::setw(9) << std::setprecision(2)
+                  << result.equity() * 100.0 << "%\n";
+    }
+
+    // 收敛提前停止：标准误差达到 0.1% 时停止
+    EquityOptions options;
+    options.max_trials = 100'000'000;
+    options.target_error = 0.001;
+    const EquityResult result = EquityCalculator::calculate(hero, options);
+    std::cout << "\n提前停止（标准误差 <= 0.1%）: " << result.trials << " 局, 胜率 "
+              << std::setprecision(2) << result.equity() * 100.0 << "% ± "
+              << result.standard_error * 100.0 << "%\n";
+
+    return 0;
+}
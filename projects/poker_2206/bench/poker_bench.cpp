@@ -0,0 +1,442 @@
+#include "Game.h"
+#include "HandEvaluator.h"
+#include "SevenCardTables.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <execution>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 全部5张牌手牌的枚举基准和正确性基线
+//
+// 1. 枚举全部 2,598,960 手牌，用每种评估器各评估一遍
+// 2. 按牌型统计出现次数，与理论值核对
+// 3. 各评估器之间逐手核对结果一致，牌力值与 evaluate() 的“牌型 + kickers”在全部手牌上等价且同序
+//    HandState / Hand 重载（含逐张 replace_card 的增量路径）与 PackedHand 的结果一致
+// 4. 报告单线程和 std::execution::par 多线程的每秒评估次数
+//
+// 5. 统计一轮换牌牌局（发牌、双方换牌、比牌）的堆分配次数，应为0
+//
+// 加 --verify7 时，再用多线程把7张牌评估器与逐一枚举21种组合的结果在全部 133,784,560 种7张牌上核对
+//
+// 注意：本游戏中 A 是最小的牌，顺子只有 A-2-3-4-5 到 9-10-J-Q-K 共9种（没有 10-J-Q-K-A），
+// 因此同花顺是 36 而不是常见的 40，顺子是 9,180 而不是 10,200，高牌相应增加
+
+// 堆分配计数：替换全局 operator new，只统计次数
+namespace {
+std::atomic<std::uint64_t> allocationCount{0};
+} // namespace
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+using namespace Poker;
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t TOTAL_HANDS = 2'598'960;
+constexpr size_t NUM_CATEGORIES = 9;
+constexpr size_t BATCH_CHUNK = 4096;  // 多线程批量评估时每个任务的手牌数
+
+// 7张牌中选5张的全部21种组合（下标）
+constexpr std::array<std::array<int, 5>, 21> SEVEN_CARD_SUBSETS = {{
+    {0, 1, 2, 3, 4}, {0, 1, 2, 3, 5}, {0, 1, 2, 3, 6}, {0, 1, 2, 4, 5}, {0, 1, 2, 4, 6},
+    {0, 1, 2, 5, 6}, {0, 1, 3, 4, 5}, {0, 1, 3, 4, 6}, {0, 1, 3, 5, 6}, {0, 1, 4, 5, 6},
+    {0, 2, 3, 4, 5}, {0, 2, 3, 4, 6}, {0, 2, 3, 5, 6}, {0, 2, 4, 5, 6}, {0, 3, 4, 5, 6},
+    {1, 2, 3, 4, 5}, {1, 2, 3, 4, 6}, {1, 2, 3, 5, 6}, {1, 2, 4, 5, 6}, {1, 3, 4, 5, 6},
+    {2, 3, 4, 5, 6},
+}};
+
+// 各牌型的理论出现次数（按 HandRank 顺序）
+constexpr std::array<std::uint64_t, NUM_CATEGORIES> EXPECTED_COUNTS = {
+    1'303'560,  // 高牌
+    1'098'240,  // 一对
+    123'552,    // 两对
+    54'912,     // 三条
+    9'180,      // 顺子
+    5'112,      // 同花
+    3'744,      // 葫芦
+    624,        // 四条
+    36,         // 同花顺
+};
+
+const std::array<const char*, NUM_CATEGORIES> CATEGORY_NAMES = {
+    "高牌", "一对", "两对", "三条", "顺子", "同花", "葫芦", "四条", "同花顺"
+};
+
+using CategoryCounts = std::array<std::uint64_t, NUM_CATEGORIES>;
+
+std::vector<PackedHand> enumerate_hands() {
+    std::vector<PackedHand> hands;
+    hands.reserve(TOTAL_HANDS);
+    for (unsigned a = 0; a < Deck::DECK_SIZE; ++a)
+        for (unsigned b = a + 1; b < Deck::DECK_SIZE; ++b)
+            for (unsigned c = b + 1; c < Deck::DECK_SIZE; ++c)
+                for (unsigned d = c + 1; d < Deck::DECK_SIZE; ++d)
+                    for (unsigned e = d + 1; e < Deck::DECK_SIZE; ++e) {
+                        PackedHand hand;
+                        for (unsigned index : {a, b, c, d, e}) {
+                            hand.add_card(PackedCard::from_index(index));
+                        }
+                        hands.push_back(hand);
+                    }
+    return hands;
+}
+
+double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+CategoryCounts count_categories(const std::vector<HandStrength>& strengths) {
+    CategoryCounts counts{};
+    for (const HandStrength strength : strengths) {
+        counts[static_cast<size_t>(HandEvaluator::strength_to_rank(strength))]++;
+    }
+    return counts;
+}
+
+bool check_counts(const std::string& name, const CategoryCounts& counts) {
+    if (counts == EXPECTED_COUNTS) {
+        return true;
+    }
+    std::cout << "  [错误] " << name << " 的牌型统计与理论值不符\n";
+    for (size_t i = 0; i < NUM_CATEGORIES; ++i) {
+        if (counts[i] != EXPECTED_COUNTS[i]) {
+            std::cout << "    " << CATEGORY_NAMES[i] << ": " << counts[i] << "（应为 " << EXPECTED_COUNTS[i] << "）\n";
+        }
+    }
+    return false;
+}
+
+// HandEvaluation 打包成一个整数：牌型占高4位，之后每个 kicker 4位，不足5个时低位补0
+// 同一牌型的 kickers 个数相同，整数顺序就是先比牌型、再逐个比 kickers 的顺序
+std::uint32_t pack_evaluation(const HandEvaluation& eval) {
+    std::uint32_t packed = static_cast<std::uint32_t>(eval.rank);
+    for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+        packed = packed << 4 | (i < eval.kickers.size() ? static_cast<std::uint32_t>(eval.kickers[i]) : 0);
+    }
+    return packed;
+}
+
+// 牌力值与 evaluate() 的结果逐手核对（evaluate 不经过 rank_hand，是建表规则的独立参照）
+// - 每个牌力值只对应一种评估结果：牌力值相等 ⇒ 牌型和 kickers 相等
+// - 按牌力值从小到大，评估结果严格递增：牌力值的顺序就是评估的顺序，评估相等 ⇒ 牌力值相等
+bool check_evaluation_order(const std::vector<HandStrength>& strengths, const std::vector<std::uint32_t>& evaluations) {
+    constexpr std::uint32_t UNSEEN = ~std::uint32_t{0};
+    std::vector<std::uint32_t> byStrength(HandEvaluator::NUM_STRENGTHS + 1, UNSEEN);
+
+    for (size_t i = 0; i < strengths.size(); ++i) {
+        const HandStrength strength = strengths[i];
+        if (strength == 0 || strength > HandEvaluator::NUM_STRENGTHS) {
+            std::cout << "  [错误] 第 " << i << " 手的牌力值 " << strength << " 越界\n";
+            return false;
+        }
+        if (byStrength[strength] == UNSEEN) {
+            byStrength[strength] = evaluations[i];
+        } else if (byStrength[strength] != evaluations[i]) {
+            std::cout << "  [错误] 牌力值 " << strength << " 对应两种不同的评估结果\n";
+            return false;
+        }
+    }
+    for (HandStrength strength = 1; strength <= HandEvaluator::NUM_STRENGTHS; ++strength) {
+        if (byStrength[strength] == UNSEEN) {
+            std::cout << "  [错误] 牌力值 " << strength << " 没有出现\n";
+            return false;
+        }
+        if (strength > 1 && byStrength[strength] <= byStrength[strength - 1]) {
+            std::cout << "  [错误] 牌力值 " << strength - 1 << " 和 " << strength << " 的评估顺序不一致\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+void print_row(const std::string& name, double singleSeconds, double parallelSeconds, bool ok) {
+    const auto rate = [](double seconds) { return static_cast<double>(TOTAL_HANDS) / seconds / 1e6; };
+    std::cout << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(14) << rate(singleSeconds) << std::setw(14) << rate(parallelSeconds)
+              << std::setw(8) << (ok ? "通过" : "失败") << "\n";
+}
+
+// 7张牌评估器与21种组合枚举逐一核对（多线程，按前两张牌分任务）
+bool verify_seven_card() {
+    SevenCardTables::instance();  // 在计时之外生成表
+
+    std::vector<std::pair<unsigned, unsigned>> tasks;
+    for (unsigned a = 0; a < Deck::DECK_SIZE; ++a) {
+        for (unsigned b = a + 1; b < Deck::DECK_SIZE; ++b) {
+            tasks.emplace_back(a, b);
+        }
+    }
+
+    std::atomic<std::uint64_t> checked{0};
+    std::atomic<std::uint64_t> mismatches{0};
+    const auto start = Clock::now();
+
+    std::for_each(std::execution::par, tasks.begin(), tasks.end(), [&](const auto& task) {
+        std::uint64_t localChecked = 0;
+        std::uint64_t localMismatches = 0;
+        std::array<PackedCard, SevenCardTables::HAND_SIZE> cards{};
+        cards[0] = PackedCard::from_index(task.first);
+        cards[1] = PackedCard::from_index(task.second);
+
+        for (unsigned c = task.second + 1; c < Deck::DECK_SIZE; ++c)
+            for (unsigned d = c + 1; d < Deck::DECK_SIZE; ++d)
+                for (unsigned e = d + 1; e < Deck::DECK_SIZE; ++e)
+                    for (unsigned f = e + 1; f < Deck::DECK_SIZE; ++f)
+                        for (unsigned g = f + 1; g < Deck::DECK_SIZE; ++g) {
+                            cards[2] = PackedCard::from_index(c);
+                            cards[3] = PackedCard::from_index(d);
+                            cards[4] = PackedCard::from_index(e);
+                            cards[5] = PackedCard::from_index(f);
+                            cards[6] = PackedCard::from_index(g);
+
+                            HandStrength best = 0;
+                            for (const auto& subset : SEVEN_CARD_SUBSETS) {
+                                PackedHand hand;
+                                for (const int i : subset) {
+                                    hand.add_card(cards[i]);
+                                }
+                                best = std::max(best, HandEvaluator::evaluate_strength(hand));
+                            }
+                            if (best != HandEvaluator::evaluate_strength7(cards)) {
+                                ++localMismatches;
+                            }
+                            ++localChecked;
+                        }
+
+        checked.fetch_add(localChecked, std::memory_order_relaxed);
+        mismatches.fetch_add(localMismatches, std::memory_order_relaxed);
+    });
+
+    std::cout << "\n7张牌核对: " << checked.load() << " 手, 不一致 " << mismatches.load() << " 手, 用时 "
+              << std::setprecision(1) << seconds_since(start) << " 秒\n";
+    return mismatches.load() == 0;
+}
+
+// 按枚举顺序逐手换牌：只用 replace_card 替换与上一手不同的牌，核对增量维护的 HandState 和 Hand
+// 从前往后替换，新牌只会和已经换掉的旧牌相同，中途不会出现重复的牌
+bool check_incremental_scores(const std::vector<PackedHand>& hands, const std::vector<HandScore>& scores) {
+    PackedHand previous = hands.front();
+    HandState state(previous.get_cards());
+    Hand hand = previous.to_hand();
+    std::uint64_t replaced = 0;
+    const auto start = Clock::now();
+
+    for (size_t i = 0; i < hands.size(); ++i) {
+        const auto before = previous.get_cards();
+        const auto after = hands[i].get_cards();
+        for (size_t k = 0; k < Hand::HAND_SIZE; ++k) {
+            if (after[k] != before[k]) {
+                state.replace_card(before[k], after[k]);
+                hand.replace_card(k, after[k].to_card());
+                ++replaced;
+            }
+        }
+        if (HandEvaluator::evaluate_score(state) != scores[i] || HandEvaluator::evaluate_score(hand) != scores[i]) {
+            std::cout << "\n  [错误] 第 " << i << " 手增量评估的比较分值不一致\n";
+            return false;
+        }
+        previous = hands[i];
+    }
+
+    std::cout << "\n增量评估: 逐手换牌共替换 " << replaced << " 张, 用时 " << std::setprecision(2)
+              << seconds_since(start) << " 秒  通过\n";
+    return true;
+}
+
+// 无界面换牌牌局的平均每轮堆分配次数
+bool check_round_allocations() {
+    constexpr std::uint64_t ROUNDS = 100'000;
+
+    Deck deck(1);
+    AIPlayer player1("AI-1");
+    AIPlayer player2("AI-2");
+    Game::play_headless_round(deck, player1, player2);  // 在计数之外生成表
+
+    const std::uint64_t before = allocationCount.load(std::memory_order_relaxed);
+    const auto start = Clock::now();
+    for (std::uint64_t i = 0; i < ROUNDS; ++i) {
+        Game::play_headless_round(deck, player1, player2);
+    }
+    const double elapsed = seconds_since(start);
+    const std::uint64_t allocations = allocationCount.load(std::memory_order_relaxed) - before;
+
+    std::cout << "\n换牌牌局: " << std::setprecision(2)
+              << static_cast<double>(ROUNDS) / elapsed / 1e6 << " M局/秒, 每轮堆分配 "
+              << static_cast<double>(allocations) / static_cast<double>(ROUNDS) << " 次  "
+              << (allocations == 0 ? "通过" : "失败") << "\n";
+    return allocations == 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const bool verify7 = argc > 1 && std::strcmp(argv[1], "--verify7") == 0;
+
+    std::cout << "=== 全部5张牌手牌枚举基准 ===\n";
+    std::cout << "硬件线程数: " << std::thread::hardware_concurrency() << "\n";
+
+    const std::vector<PackedHand> hands = enumerate_hands();
+    HandEvaluator::evaluate_strength(hands.front());  // 在计时之外生成表
+
+    std::cout << "手牌数: " << hands.size() << "\n\n";
+    // 中文字符按显示宽度手工对齐
+    std::cout << "评估器                           单线程 M/秒   多线程 M/秒    核对\n";
+
+    bool ok = true;
+    std::vector<HandStrength> reference(hands.size());
+
+    // 查表评估（单手）
+    {
+        auto start = Clock::now();
+        std::transform(hands.begin(), hands.end(), reference.begin(),
+                       [](const PackedHand& hand) { return HandEvaluator::evaluate_strength(hand); });
+        const double single = seconds_since(start);
+
+        std::vector<HandStrength> parallel(hands.size());
+        start = Clock::now();
+        std::transform(std::execution::par, hands.begin(), hands.end(), parallel.begin(),
+                       [](const PackedHand& hand) { return HandEvaluator::evaluate_strength(hand); });
+        const double multi = seconds_since(start);
+
+        const bool rowOk = check_counts("evaluate_strength", count_categories(reference)) && parallel == reference;
+        print_row("evaluate_strength", single, multi, rowOk);
+        ok = ok && rowOk;
+    }
+
+    // 批量评估（AVX2 或逐手）
+    {
+        std::vector<HandStrength> single(hands.size());
+        auto start = Clock::now();
+        HandEvaluator::evaluate_batch(hands, single);
+        const double singleSeconds = seconds_since(start);
+
+        std::vector<size_t> chunks((hands.size() + BATCH_CHUNK - 1) / BATCH_CHUNK);
+        std::iota(chunks.begin(), chunks.end(), 0);
+        std::vector<HandStrength> parallel(hands.size());
+        start = Clock::now();
+        std::for_each(std::execution::par, chunks.begin(), chunks.end(), [&](size_t chunk) {
+            const size_t begin = chunk * BATCH_CHUNK;
+            const size_t count = std::min(BATCH_CHUNK, hands.size() - begin);
+            HandEvaluator::evaluate_batch(std::span(hands).subspan(begin, count),
+                                          std::span(parallel).subspan(begin, count));
+        });
+        const double multiSeconds = seconds_since(start);
+
+        const bool rowOk = single == reference && parallel == reference;
+        print_row("evaluate_batch", singleSeconds, multiSeconds, rowOk);
+        ok = ok && rowOk;
+    }
+
+    // 比较分值（牌力值 + 花色）
+    std::vector<HandScore> scores(hands.size());
+    {
+        auto start = Clock::now();
+        std::transform(hands.begin(), hands.end(), scores.begin(),
+                       [](const PackedHand& hand) { return HandEvaluator::evaluate_score(hand); });
+        const double single = seconds_since(start);
+
+        std::vector<HandScore> parallel(hands.size());
+        start = Clock::now();
+        std::transform(std::execution::par, hands.begin(), hands.end(), parallel.begin(),
+                       [](const PackedHand& hand) { return HandEvaluator::evaluate_score(hand); });
+        const double multi = seconds_since(start);
+
+        bool rowOk = parallel == scores;
+        for (size_t i = 0; i < hands.size() && rowOk; ++i) {
+            rowOk = HandEvaluator::score_to_strength(scores[i]) == reference[i];
+        }
+        print_row("evaluate_score", single, multi, rowOk);
+        ok = ok && rowOk;
+    }
+
+    // 增量评估状态：从头构造的 HandState 计时；HandState 和 Hand 两种重载的牌力值、比较分值都与 PackedHand 核对
+    {
+        const auto evaluate = [](const PackedHand& hand) {
+            return HandEvaluator::evaluate_score(HandState(hand.get_cards()));
+        };
+
+        std::vector<HandScore> single(hands.size());
+        auto start = Clock::now();
+        std::transform(hands.begin(), hands.end(), single.begin(), evaluate);
+        const double singleSeconds = seconds_since(start);
+
+        std::vector<HandScore> parallel(hands.size());
+        start = Clock::now();
+        std::transform(std::execution::par, hands.begin(), hands.end(), parallel.begin(), evaluate);
+        const double multiSeconds = seconds_since(start);
+
+        bool rowOk = single == scores && parallel == scores;
+        for (size_t i = 0; i < hands.size() && rowOk; ++i) {
+            const Hand hand = hands[i].to_hand();
+            rowOk = HandEvaluator::evaluate_strength(HandState(hands[i].get_cards())) == reference[i] &&
+                    HandEvaluator::evaluate_strength(hand) == reference[i] &&
+                    HandEvaluator::evaluate_score(hand) == scores[i];
+        }
+        print_row("evaluate_score (HandState)", singleSeconds, multiSeconds, rowOk);
+        ok = ok && rowOk;
+    }
+
+    // 原始评估（HandEvaluation，含转换为 Hand 的开销），核对牌型和 kickers
+    {
+        const auto evaluate = [](const PackedHand& hand) {
+            return pack_evaluation(HandEvaluator::evaluate(hand.to_hand()));
+        };
+
+        std::vector<std::uint32_t> single(hands.size());
+        auto start = Clock::now();
+        std::transform(hands.begin(), hands.end(), single.begin(), evaluate);
+        const double singleSeconds = seconds_since(start);
+
+        std::vector<std::uint32_t> parallel(hands.size());
+        start = Clock::now();
+        std::transform(std::execution::par, hands.begin(), hands.end(), parallel.begin(), evaluate);
+        const double multiSeconds = seconds_since(start);
+
+        const bool rowOk = parallel == single && check_evaluation_order(reference, single);
+        print_row("evaluate (HandEvaluation)", singleSeconds, multiSeconds, rowOk);
+        ok = ok && rowOk;
+    }
+
+    std::cout << "\n牌型统计:\n";
+    const CategoryCounts counts = count_categories(reference);
+    for (size_t i = NUM_CATEGORIES; i-- > 0;) {
+        std::cout << "  " << std::left << std::setw(12) << CATEGORY_NAMES[i] << std::right << std::setw(10)
+                  << counts[i] << std::setw(12) << std::setprecision(4)
+                  << static_cast<double>(counts[i]) * 100.0 / static_cast<double>(TOTAL_HANDS) << "%\n";
+    }
+
+    ok = check_incremental_scores(hands, scores) && ok;
+    ok = check_round_allocations() && ok;
+
+    if (verify7) {
+        ok = verify_seven_card() && ok;
+    }
+
+    std::cout << "\n" << (ok ? "全部核对通过" : "核对失败") << "\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Deck.h"
+#include "PackedHand.h"
+#include <array>
+#include <cstdint>
+
+namespace Poker {
+
+// 花色同构的规范形式
+//
+// 只与点数和花色结构有关的计算（换牌期望、胜率等）在花色互换下不变。
+// 把4种花色的13位点数掩码从大到小排序后重新编号，花色互换的手牌得到同一个键，
+// 5张牌的 2,598,960 种手牌因此只剩 134,459 个等价类
+struct CanonicalHand {
+    std::uint64_t key = 0;  // 规范形式的64位牌掩码（与 PackedHand::mask 布局相同）
+
+    // 原花色 -> 规范花色
+    std::array<std::uint8_t, Deck::NUM_SUITS> suit_map{};
+
+    // 规范牌序：order[i] 是规范掩码中第 i 低位的牌在原手牌中的位置
+    // 与位置有关的结果（如换牌掩码）按这个顺序缓存，取出时再映射回原来的位置
+    std::array<std::uint8_t, Hand::HAND_SIZE> order{};
+
+    // 原手牌位置掩码 -> 规范牌序掩码
+    [[nodiscard]] std::uint8_t to_canonical(std::uint8_t positions) const noexcept;
+
+    // 规范牌序掩码 -> 原手牌位置掩码
+    [[nodiscard]] std::uint8_t from_canonical(std::uint8_t positions) const noexcept;
+};
+
+class Canonicalizer {
+public:
+    // 计算规范形式（包括花色映射和规范牌序）
+    static CanonicalHand canonicalize(const PackedHand& hand) noexcept;
+
+    // 只计算规范键：任意张数的64位牌掩码
+    static std::uint64_t canonical_key(std::uint64_t mask) noexcept;
+
+    static std::uint64_t canonical_key(const PackedHand& hand) noexcept {
+        return canonical_key(hand.mask());
+    }
+};
+
+} // namespace Poker
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "HandEvaluator.h"
+#include "PackedHand.h"
+#include "Player.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Poker {
+
+class WorkStealingPool;
+
+// CFR 抽象博弈中的换牌动作（具体换哪几张由手牌决定）
+enum class DrawAction : std::uint8_t {
+    StandPat,      // 不换
+    Draw1,         // 按（同点数张数, 点数）从小到大换掉最弱的1张
+    Draw2,         // 同上，2张
+    Draw3,         // 同上，3张
+    Draw4,         // 同上，4张（只留最强的1张）
+    FlushDraw,     // 保留张数最多的花色，换掉其他花色的牌
+    StraightDraw   // 保留落在同一个5连点数窗口内最多的牌（含中间缺张），换掉其他的牌
+};
+
+// 简化五张换牌扑克的抽象
+//
+// - 换牌前：牌力分 16 档（高牌 4 档、一对 5 档按类内百分位，两对及以上每种牌型 1 档），
+//   再区分是否4张同花、是否4张在同一个5连点数窗口内（顺子听牌），共 64 个桶
+// - 换牌动作：见 DrawAction
+// - 换牌后：按牌力值百分位分 32 个桶
+// - 对手换了几张牌（0..5）是公开信息，用于下注阶段
+//
+// 百分位表在首次使用时由全部 2,598,960 手牌的牌力分布生成
+class CfrAbstraction {
+public:
+    static constexpr size_t DRAW_ACTIONS = 7;
+    static constexpr size_t STRENGTH_BUCKETS = 16;
+    static constexpr size_t PRE_BUCKETS = STRENGTH_BUCKETS * 4;
+    static constexpr size_t POST_BUCKETS = 32;
+    static constexpr size_t DRAW_COUNTS = Hand::HAND_SIZE + 1;
+
+    static const CfrAbstraction& instance();
+
+    // 换牌前的桶（0..PRE_BUCKETS-1），查表 + 位运算
+    [[nodiscard]] size_t pre_bucket(const PackedHand& hand) const noexcept;
+
+    // 换牌后的桶（0..POST_BUCKETS-1）
+    [[nodiscard]] size_t post_bucket(HandStrength strength) const noexcept { return postBuckets_[strength]; }
+
+    // 换牌动作对应的换牌掩码
+    [[nodiscard]] static DiscardMask draw_mask(const PackedHand& hand, DrawAction action) noexcept;
+
+    CfrAbstraction(const CfrAbstraction&) = delete;
+    CfrAbstraction& operator=(const CfrAbstraction&) = delete;
+
+private:
+    CfrAbstraction();
+
+    static constexpr size_t STRENGTH_VALUES = 7463;  // 牌力值 1..7462，0 表示不完整
+
+    std::array<std::uint8_t, STRENGTH_VALUES> strengthBuckets_{};
+    std::array<std::uint8_t, STRENGTH_VALUES> postBuckets_{};
+};
+
+// 训练参数
+struct CfrOptions {
+    std::uint64_t iterations = 1000;
+    std::uint64_t samples_per_iteration = 4096;  // 每次迭代采样的发牌数（并行遍历）
+    size_t threads = 0;                          // 线程数，0 表示使用全部核心
+    std::uint64_t seed = 0;                      // 随机种子，0 表示每次使用不同的种子
+
+    std::string checkpoint_path;              // 为空时不保存检查点
+    std::uint64_t checkpoint_interval = 100;  // 每隔多少次迭代保存一次
+};
+
+// 训练得到的平均策略（只读，可在多个玩家、多个线程间共享）
+class CfrStrategy {
+public:
+    static constexpr size_t BET_HISTORIES = 4;  // BetHistory 的取值个数
+
+    CfrStrategy(std::vector<float> drawProbabilities, std::vector<float> betProbabilities);
+
+    // 换牌动作（取平均策略中概率最大的动作），position 0 为玩家1、1 为庄家（玩家2，先换牌）
+    [[nodiscard]] DrawAction draw_action(size_t position, const PackedHand& hand) const noexcept;
+
+    [[nodiscard]] float draw_probability(size_t position, size_t preBucket, DrawAction action) const noexcept;
+
+    // 下注（面对下注时为跟注）的概率；行动的一方由 history 决定
+    [[nodiscard]] float bet_probability(BetHistory history, size_t postBucket, size_t opponentDraws) const noexcept;
+
+private:
+    std::vector<float> drawProbabilities_;
+    std::vector<float> betProbabilities_;
+    std::vector<DrawAction> bestDraws_;  // 每个换牌信息集预先选好的动作
+};
+
+// 简化五张换牌扑克的 CFR+ 求解器
+//
+// 抽象博弈与 Game 的无界面牌局一致：双方各下底注 Game::ANTE，发5张牌，庄家（玩家2）先从牌堆补牌，
+// 玩家1再补（换牌时看不到对方的动作，信息集只取决于自己的桶），然后一轮固定下注额 Game::BET_SIZE 的下注
+// （见 BetHistory，信息集为换牌后的桶和对手换牌的张数），摊牌按 HandComparator 的规则（含花色）比较。
+//
+// - 遗憾值和策略累计值存放在两个扁平的 float 数组中（信息集 x 动作）
+// - 每次迭代采样 samples_per_iteration 次发牌，分成固定的若干块在线程池中并行遍历，
+//   各块累加自己的增量，迭代结束时按块的顺序合并（结果与线程数无关）
+// - CFR+：遗憾值截断为非负，平均策略按迭代次数线性加权
+class CfrSolver {
+public:
+    explicit CfrSolver(CfrOptions options = {});
+
+    // 训练 options.iterations 次迭代（从检查点恢复时继续累加）
+    void train();
+
+    // 保存 / 读取检查点（迭代次数 + 两个表），读取失败时抛出 std::runtime_error
+    void save_checkpoint(const std::string& path) const;
+    void load_checkpoint(const std::string& path);
+
+    [[nodiscard]] std::uint64_t iteration() const noexcept { return iteration_; }
+
+    // 当前的平均策略
+    [[nodiscard]] std::shared_ptr<const CfrStrategy> strategy() const;
+
+    // 表的大小
+    static constexpr size_t DRAW_INFOSETS = 2 * CfrAbstraction::PRE_BUCKETS;
+    static constexpr size_t BET_INFOSETS =
+        CfrStrategy::BET_HISTORIES * CfrAbstraction::POST_BUCKETS * CfrAbstraction::DRAW_COUNTS;
+    static constexpr size_t BET_ACTIONS = 2;
+    static constexpr size_t DRAW_ENTRIES = DRAW_INFOSETS * CfrAbstraction::DRAW_ACTIONS;
+    static constexpr size_t TABLE_SIZE = DRAW_ENTRIES + BET_INFOSETS * BET_ACTIONS;
+
+private:
+    void iterate(WorkStealingPool& pool);
+
+    CfrOptions options_;
+    std::uint64_t seed_;
+    std::uint64_t iteration_ = 0;
+    std::vector<float> regrets_;
+    std::vector<float> strategySums_;
+};
+
+// 使用 CFR 策略的 AI 玩家：换牌和下注都按桶查表，O(1)
+// 下注按平均策略的概率混合，随机数由手牌和下注历史散列得到（无状态，可在线程间复制）
+class CfrPlayer : public Player {
+public:
+    // position 为座位：0 = 玩家1，1 = 庄家（玩家2）
+    CfrPlayer(const std::string& name, std::shared_ptr<const CfrStrategy> strategy, size_t position = 1);
+
+    DiscardMask decide_discards() override;
+    bool decide_bet(BetHistory history, size_t opponentDraws) override;
+    [[nodiscard]] std::unique_ptr<Player> clone() const override;
+
+private:
+    std::shared_ptr<const CfrStrategy> strategy_;
+    size_t position_;
+};
+
+} // namespace Poker
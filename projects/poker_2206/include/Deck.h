@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Card.h"
+#include "Random.h"
 #include <array>
 #include <vector>
 #include <optional>
@@ -8,7 +9,9 @@
 
 namespace Poker {
 
-class Deck {
+// 牌堆，Rng 为随机数策略（Random.h 中的发生器，或任意 UniformRandomBitGenerator）
+template <typename Rng>
+class BasicDeck {
 public:
     // size_t 是一个无符号整数类型（unsigned integer type），定义在 <cstddef> 头文件中。
     // 它的具体大小取决于平台：
@@ -18,19 +21,67 @@ public:
     static constexpr size_t NUM_SUITS = 4;
     static constexpr size_t NUM_RANKS = 13;
 
-    Deck();
+    // 从 std::random_device 取种子
+    BasicDeck() : BasicDeck((std::uint64_t{std::random_device{}()} << 32) | std::random_device{}()) {}
+
+    // 固定种子，牌局可以复现
+    explicit BasicDeck(std::uint64_t seed) : currentIndex_(0), rng_(seed) {
+        init_deck();
+    }
 
     // 洗牌（Fisher-Yates shuffle）算法
-    void shuffle();
+    void shuffle() {
+        partial_shuffle(std::span<Card>(cards_), DECK_SIZE, rng_);
+        currentIndex_ = 0;
+        shuffledCount_ = DECK_SIZE;
+        shuffled_ = true;
+    }
+
+    // 部分洗牌：只洗将要发出的前 count 张，之后再发牌时每发一张才多洗一步
+    // 发出的牌与完整洗牌同样均匀，模拟只用到十几张牌时省掉大部分交换
+    void shuffle(size_t count) {
+        partial_shuffle(std::span<Card>(cards_), count, rng_);
+        currentIndex_ = 0;
+        shuffledCount_ = count;
+        shuffled_ = true;
+    }
 
     // 发一张牌
-    [[nodiscard]] std::optional<Card> deal_card();
+    [[nodiscard]] std::optional<Card> deal_card() {
+        if (!has_cards()) {
+            return std::nullopt;
+        }
+        // 部分洗牌后发到了未洗过的位置：补做这一步 Fisher-Yates
+        if (shuffled_ && currentIndex_ >= shuffledCount_) {
+            partial_shuffle(std::span<Card>(cards_).subspan(currentIndex_), 1, rng_);
+            shuffledCount_ = currentIndex_ + 1;
+        }
+        return cards_[currentIndex_++];
+    }
 
     // 发多张牌
-    [[nodiscard]] std::vector<Card> deal_cards(size_t count);
+    [[nodiscard]] std::vector<Card> deal_cards(size_t count) {
+        std::vector<Card> result;
+        result.reserve(count);
+
+        for (size_t i = 0; i < count && has_cards(); ++i) {
+            if (auto card = deal_card()) {
+                result.push_back(*card);
+            }
+        }
+
+        return result;
+    }
 
     // 重置牌堆
-    void reset();
+    void reset() {
+        currentIndex_ = 0;
+        shuffled_ = false;
+        init_deck();
+    }
+
+    // 重新设置种子
+    void seed(std::uint64_t seed) { rng_ = Rng(seed); }
 
     // 获取剩余牌数
     [[nodiscard]] size_t remaining_cards() const noexcept { return DECK_SIZE - currentIndex_; }
@@ -41,9 +92,23 @@ public:
 private:
     std::array<Card, DECK_SIZE> cards_;
     size_t currentIndex_;
-    std::mt19937 rng_;
+    size_t shuffledCount_ = 0;  // 已经洗过的前缀长度
+    bool shuffled_ = false;     // 未洗牌时按顺序发牌
+    Rng rng_;
 
-    void init_deck();
+    void init_deck() {
+        size_t index = 0;
+        for (int suit = 0; suit < static_cast<int>(NUM_SUITS); ++suit) {
+            for (int rank = 1; rank <= static_cast<int>(NUM_RANKS); ++rank) {
+                cards_[index++] = Card(static_cast<Suit>(suit), static_cast<Rank>(rank));
+            }
+        }
+    }
 };
 
+// 默认使用 xoshiro256**
+using Deck = BasicDeck<Xoshiro256StarStar>;
+
+extern template class BasicDeck<Xoshiro256StarStar>;
+
 } // namespace Poker
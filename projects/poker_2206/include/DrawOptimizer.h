@@ -0,0 +1,38 @@
+#pragma once
+
+#include "HandEvaluator.h"
+#include "PackedHand.h"
+#include <array>
+#include <cstdint>
+
+namespace Poker {
+
+// 换牌决策：全部32种换牌方式的期望牌力值，以及其中最好的一种
+struct DrawDecision {
+    static constexpr size_t NUM_DISCARDS = 1 << Hand::HAND_SIZE;
+
+    std::uint8_t best_discards = 0;                   // 期望最高的换牌掩码（第 i 位 = 第 i 张牌）
+    std::array<double, NUM_DISCARDS> expected_strength{};  // 按换牌掩码索引的期望牌力值
+
+    [[nodiscard]] double best_expected_strength() const noexcept {
+        return expected_strength[best_discards];
+    }
+};
+
+// 穷举换牌优化器
+//
+// 对32种换牌方式，枚举剩余47张牌中所有可能的补牌组合（共 2,598,960 种），
+// 计算换牌后牌力值（HandStrength）的精确期望，选出期望最高的换牌方式。
+//
+// 枚举时保留牌的质数之积、点数位或、花色位与逐张累加，最内层直接查表，不构造手牌。
+// 结果只与手牌的花色结构有关，按花色同构的规范形式缓存，花色互换的手牌共享同一个结果
+class DrawOptimizer {
+public:
+    // 查缓存，未命中时穷举并写入缓存（线程安全）
+    static DrawDecision optimize(const PackedHand& hand);
+
+    // 不使用缓存，直接穷举
+    static DrawDecision enumerate(const PackedHand& hand);
+};
+
+} // namespace Poker
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Hand.h"
+#include "PackedHand.h"
+#include <cstdint>
+#include <optional>
+
+namespace Poker {
+
+// 蒙特卡洛胜率计算的参数
+struct EquityOptions {
+    std::uint64_t max_trials = 1'000'000;  // 最多模拟的牌局数
+    size_t threads = 0;                    // 线程数，0 表示使用全部核心
+    std::uint64_t batch_size = 4096;       // 每个线程一次领取的牌局数
+    double target_error = 0.0;             // 胜率标准误差达到该值时提前停止，0 表示不提前停止
+    std::uint64_t seed = 0;                // 随机种子，0 表示每次使用不同的种子
+
+    // 我方的换牌：nullopt 表示按 AIPlayer 的策略换牌，否则为位置掩码（第 i 位 = 第 i 张牌）
+    std::optional<std::uint8_t> hero_discards;
+
+    // 按花色同构的规范形式缓存结果：花色互换的手牌（参数相同时）直接返回首次计算的结果
+    // 注意花色比较规则使胜率只是近似花色不变（仅影响牌力完全相同的牌局）
+    bool use_cache = false;
+};
+
+// 胜率计算结果
+struct EquityResult {
+    std::uint64_t trials = 0;
+    std::uint64_t wins = 0;
+    std::uint64_t ties = 0;
+    std::uint64_t losses = 0;
+    double standard_error = 0.0;  // 胜率（平局记一半）的标准误差
+    bool converged = false;       // 是否因达到 target_error 提前停止
+
+    [[nodiscard]] double win_rate() const noexcept;
+    [[nodiscard]] double tie_rate() const noexcept;
+    [[nodiscard]] double loss_rate() const noexcept;
+
+    // 胜率：获胜 + 平局的一半
+    [[nodiscard]] double equity() const noexcept;
+};
+
+// 五张换牌扑克的胜率计算
+//
+// 每局模拟：从剩余47张牌中给对手发5张，双方各换一次牌后比牌。
+// 对手按 AIPlayer 的策略换牌。
+//
+// 多线程：牌局按批次分给各线程，每个线程有独立的随机数流和独立的统计结果，
+// 结束时再合并；设置 target_error 时每完成一批检查一次是否已经收敛
+class EquityCalculator {
+public:
+    static EquityResult calculate(const Hand& hero, const EquityOptions& options = {});
+    static EquityResult calculate(const PackedHand& hero, const EquityOptions& options = {});
+};
+
+} // namespace Poker
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Deck.h"
+#include "HandEvaluator.h"
+#include <array>
+#include <cstdint>
+
+namespace Poker {
+
+// 查表评估器使用的预计算表（Cactus Kev 风格）
+//
+// 一手5张牌按三种情况查表：
+// - 同花：以13位点数掩码为下标查 flush 表
+// - 5张点数各不相同：以点数掩码为下标查 unique5 表
+// - 有重复点数：以点数质数之积为键，经完美哈希查 paired 表
+//
+// 表中的值是牌力值（HandStrength），与 HandEvaluator::evaluate 的“牌型 + kickers”顺序完全一致
+//
+// 表由 constexpr 构造函数按 HandEvaluator::rank_hand 生成（与 evaluate 的规则相同、实现独立，poker_bench 核对两者）。
+// 默认在编译期求值，放在只读数据段中；
+// CMake 选项 POKER_CONSTEXPR_TABLES=OFF 时改为首次使用时在运行期执行同一段代码（编译更快）
+class EvaluatorTables {
+public:
+    static constexpr size_t RANK_MASK_SIZE = 1 << Deck::NUM_RANKS;  // 13位点数掩码
+    static constexpr size_t PAIRED_BUCKET_BITS = 11;
+    static constexpr size_t PAIRED_BUCKETS = 1 << PAIRED_BUCKET_BITS;
+    static constexpr size_t PAIRED_SLOTS = 1 << 13;
+
+    // 批量评估用32位 gather 读取16位表项，每张表末尾多留一项，读取最后一项时不会越界
+    static constexpr size_t GATHER_PADDING = 1;
+
+    // 获取全局唯一的表
+    static const EvaluatorTables& instance();
+
+    [[nodiscard]] HandStrength flush(std::uint32_t rankMask) const noexcept {
+        return flush_[rankMask];
+    }
+
+    [[nodiscard]] HandStrength unique5(std::uint32_t rankMask) const noexcept {
+        return unique5_[rankMask];
+    }
+
+    // 有重复点数的手牌：两级完美哈希（hash and displace）
+    [[nodiscard]] HandStrength paired(std::uint32_t primeProduct) const noexcept {
+        const std::uint32_t h = mix(primeProduct);
+        const std::uint32_t bucket = h >> (32 - PAIRED_BUCKET_BITS);
+        return paired_[mix(h ^ displace_[bucket]) & (PAIRED_SLOTS - 1)];
+    }
+
+    // 牌力值对应的牌型
+    [[nodiscard]] HandRank category(HandStrength strength) const noexcept {
+        return category_[strength];
+    }
+
+    // 牌力值对应的第一个 kicker（花色比较时使用的点数）
+    [[nodiscard]] Rank lead_rank(HandStrength strength) const noexcept {
+        return leadRank_[strength];
+    }
+
+    // 原始表（批量评估的 SIMD gather 使用）
+    [[nodiscard]] const HandStrength* flush_data() const noexcept { return flush_.data(); }
+    [[nodiscard]] const HandStrength* unique5_data() const noexcept { return unique5_.data(); }
+    [[nodiscard]] const std::uint16_t* displace_data() const noexcept { return displace_.data(); }
+    [[nodiscard]] const HandStrength* paired_data() const noexcept { return paired_.data(); }
+
+    // 32位整数混合函数（双射），用于完美哈希
+    static constexpr std::uint32_t mix(std::uint32_t x) noexcept {
+        x ^= x >> 16;
+        x *= 0x7feb352dU;
+        x ^= x >> 15;
+        x *= 0x846ca68bU;
+        x ^= x >> 16;
+        return x;
+    }
+
+    EvaluatorTables(const EvaluatorTables&) = delete;
+    EvaluatorTables& operator=(const EvaluatorTables&) = delete;
+
+private:
+    constexpr EvaluatorTables();
+
+    std::array<HandStrength, RANK_MASK_SIZE + GATHER_PADDING> flush_{};
+    std::array<HandStrength, RANK_MASK_SIZE + GATHER_PADDING> unique5_{};
+    std::array<std::uint16_t, PAIRED_BUCKETS + GATHER_PADDING> displace_{};
+    std::array<HandStrength, PAIRED_SLOTS + GATHER_PADDING> paired_{};
+    std::array<HandRank, HandEvaluator::NUM_STRENGTHS + 1> category_{};
+    std::array<Rank, HandEvaluator::NUM_STRENGTHS + 1> leadRank_{};
+};
+
+} // namespace Poker
@@ -1,16 +1,66 @@
 #pragma once
 
 #include "Deck.h"
+#include "HandComparator.h"
 #include "Player.h"
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 namespace Poker {
 
+class HandHistoryWriter;
+struct HandHistoryRecord;
+
+// 游戏模式
+enum class GameMode {
+    Interactive,  // 控制台交互：显示牌局，等待玩家输入
+    Headless      // 无界面：不做任何控制台输入输出，用于大批量模拟
+};
+
+// 一轮牌局的结果
+struct RoundOutcome {
+    ComparisonResult result = ComparisonResult::Tie;  // 有人弃牌时另一方获胜
+    bool folded = false;
+    int player1_units = 0;  // 玩家1的净输赢（以底注为单位）
+};
+
+// 胜负统计（多线程模拟时每个线程各有一份，结束时合并）
+struct GameStatistics {
+    std::uint64_t human_wins = 0;  // 玩家1获胜
+    std::uint64_t ai_wins = 0;     // 玩家2获胜
+    std::uint64_t ties = 0;
+    std::int64_t human_units = 0;  // 玩家1的净输赢（以底注为单位）
+
+    [[nodiscard]] std::uint64_t total() const noexcept { return human_wins + ai_wins + ties; }
+
+    void record(const RoundOutcome& outcome) noexcept;
+
+    GameStatistics& operator+=(const GameStatistics& other) noexcept;
+};
+
+// 批量模拟的结果
+struct SimulationReport {
+    GameStatistics statistics;
+    size_t threads = 0;
+    double seconds = 0.0;
+    double rounds_per_second = 0.0;
+};
+
 class Game {
 public:
+    // 每人的底注和换牌后那一轮的固定下注额
+    static constexpr int ANTE = 1;
+    static constexpr int BET_SIZE = 2;
+
+    // 交互模式：人类玩家 vs AI庄家
     Game();
 
+    // 指定两名玩家（玩家1 的统计记在 human_wins，玩家2 记在 ai_wins）
+    Game(std::unique_ptr<Player> player1, std::unique_ptr<Player> player2,
+         GameMode mode = GameMode::Headless);
+
     // 开始游戏
     void start();
 
@@ -18,27 +68,61 @@ public:
     void play_round();
 
     // 玩多轮游戏
+    // 交互模式下逐轮进行；无界面模式下使用全部核心并行模拟
     void play_multiple_rounds(int numRounds);
 
+    // 无界面批量模拟：每个线程复制一份玩家、使用独立的牌堆和种子，统计结果最后合并
+    // threads 为 0 时使用全部核心，seed 为 0 时每次使用不同的种子
+    // history 不为空时记录每一局（各线程攒一批再追加），返回前写出全部记录
+    SimulationReport simulate(std::uint64_t rounds, size_t threads = 0, std::uint64_t seed = 0,
+                              HandHistoryWriter* history = nullptr);
+
     // 显示统计信息
     void show_statistics() const;
 
+    [[nodiscard]] const GameStatistics& get_statistics() const noexcept { return statistics_; }
+    [[nodiscard]] GameMode get_mode() const noexcept { return mode_; }
+
+    // 一轮无界面牌局：发牌、双方换牌、一轮下注、比牌
+    // 玩家不使用 DiscardStrategy::Optimal 时整轮不分配堆内存
+    static RoundOutcome play_headless_round(Deck& deck, Player& player1, Player& player2) {
+        return play_headless_round(deck, player1, player2, nullptr);
+    }
+
+    // 同上，record 不为空时把这一局的发牌、换牌、最终手牌和胜负写入 record
+    static RoundOutcome play_headless_round(Deck& deck, Player& player1, Player& player2,
+                                            HandHistoryRecord* record);
+
+    // 换牌后的一轮下注：玩家1先行动，过牌 / 下注，面对下注时弃牌 / 跟注
+    // draws1 / draws2 是双方换牌的张数，showdown 是双方都不弃牌时的比牌结果
+    // verbose 为 true 时输出双方的动作（交互模式）
+    static RoundOutcome betting_round(Player& player1, Player& player2, size_t draws1, size_t draws2,
+                                      ComparisonResult showdown, bool verbose = false);
+
+    // 按换牌掩码原地换牌，返回换牌数量（牌堆不够时少换）
+    static size_t replace_cards(Deck& deck, Player& player, DiscardMask discards);
+
 private:
     Deck deck_;
-    std::unique_ptr<HumanPlayer> human_player_;
-    std::unique_ptr<AIPlayer> ai_player_;
-    int human_wins_;
-    int ai_wins_;
-    int ties_;
+    std::unique_ptr<Player> human_player_;
+    std::unique_ptr<Player> ai_player_;
+    GameMode mode_;
+    GameStatistics statistics_;
 
     // 发牌给所有玩家
+    static void deal_cards(Deck& deck, Player& player1, Player& player2);
+
+    // 发牌给所有玩家（交互模式）
     void deal_cards();
 
-    // 玩家换牌阶段
-    void replace_cards_phase();
+    // 玩家换牌阶段（交互模式），返回双方换牌的张数 {玩家, 庄家}
+    std::array<size_t, 2> replace_cards_phase();
+
+    // 下注阶段（交互模式）
+    RoundOutcome betting_phase(const std::array<size_t, 2>& draws);
 
     // 显示结果
-    void showdown();
+    void showdown(const RoundOutcome& outcome);
 
     // 显示分隔线
     void print_separator() const;
@@ -1,11 +1,20 @@
 #pragma once
 
 #include "Card.h"
-#include <vector>
+#include "HandState.h"
+#include <array>
+#include <cstdint>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace Poker {
 
+// 换牌掩码：第 i 位为 1 表示换掉第 i 张牌
+using DiscardMask = std::uint8_t;
+
+// 定长手牌：牌存放在固定数组中，增删替换都不分配内存
+// 同时维护增量评估状态，换牌后重新评估只更新被换的牌
 class Hand {
 public:
     static constexpr size_t HAND_SIZE = 5;
@@ -19,20 +28,23 @@ public:
     // 替换指定位置的牌
     void replace_card(size_t index, const Card& card);
 
-    // 移除指定位置的牌
+    // 移除指定位置的牌（后面的牌前移）
     void remove_card(size_t index);
 
     // 清空手牌
     void clear();
 
     // 获取手牌
-    [[nodiscard]] const std::vector<Card>& get_cards() const noexcept { return cards_; }
+    [[nodiscard]] std::span<const Card> get_cards() const noexcept { return {cards_.data(), size_}; }
+
+    // 增量评估状态（HandEvaluator 直接查表使用）
+    [[nodiscard]] const HandState& state() const noexcept { return state_; }
 
     // 获取手牌大小
-    [[nodiscard]] size_t size() const noexcept { return cards_.size(); }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
 
     // 判断手牌是否已满
-    [[nodiscard]] bool is_full() const noexcept { return cards_.size() == HAND_SIZE; }
+    [[nodiscard]] bool is_full() const noexcept { return size_ == HAND_SIZE; }
 
     // 显示手牌
     [[nodiscard]] std::string to_string() const;
@@ -41,7 +53,9 @@ public:
     void sort_by_rank();
 
 private:
-    std::vector<Card> cards_;
+    std::array<Card, HAND_SIZE> cards_{};
+    std::uint8_t size_ = 0;
+    HandState state_;
 };
 
 } // namespace Poker
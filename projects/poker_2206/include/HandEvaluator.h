@@ -1,7 +1,12 @@
 #pragma once
 
 #include "Hand.h"
+#include "PackedHand.h"
+#include <array>
+#include <bit>
+#include <cstdint>
 #include <map>
+#include <span>
 #include <vector>
 
 namespace Poker {
@@ -30,11 +35,98 @@ struct HandEvaluation {
     std::string to_string() const;
 };
 
+// 牌力值：一手5张牌的完整强度，1..NUM_STRENGTHS，越大越强，0 表示不是完整的5张牌
+// 顺序与 HandEvaluation 的“牌型 + kickers”比较完全一致（不含花色比较）
+using HandStrength = std::uint16_t;
+
+// 比较分值：牌力值 << 2 | 第一个 kicker 点数的最大花色
+// 把牌型、kickers 和花色比较编码成一个全序整数，两手牌的比较只需一次整数比较
+using HandScore = std::uint16_t;
+
 class HandEvaluator {
 public:
+    // 不同牌力值的数量（点数组合的等价类数）
+    static constexpr HandStrength NUM_STRENGTHS = 7462;
+
+    // 点数直方图：下标为点数 - 1
+    using RankCounts = std::array<std::uint8_t, 13>;
+
+    // 定长的牌型 + kickers（不分配内存，可在常量求值中使用）
+    struct RankedHand {
+        HandRank rank = HandRank::HighCard;
+        std::array<Rank, Hand::HAND_SIZE> kickers{};
+        size_t kicker_count = 0;
+    };
+
     // 评估一手牌
     static HandEvaluation evaluate(const Hand& hand);
 
+    // 5张牌的牌型和 kickers：只取决于点数直方图和是否同花（查表评估器的建表规则，见 EvaluatorTables）
+    // 与 evaluate 的规则相同，但刻意分开实现：evaluate 是独立的参照，poker_bench 逐手核对两者
+    // - kickers 先按张数从多到少，同张数按点数从大到小（例如两对是大对、小对、单张）
+    // - 顺子：5个不同的点数连续
+    static constexpr RankedHand rank_hand(const RankCounts& counts, bool flush) noexcept {
+        RankedHand result;
+        std::array<size_t, 5> groups{};  // groups[n] = 恰好 n 张的点数个数
+        std::uint32_t rankMask = 0;
+        for (int n = 4; n >= 1; --n) {
+            for (int r = static_cast<int>(counts.size()) - 1; r >= 0; --r) {
+                if (counts[r] == n && result.kicker_count < Hand::HAND_SIZE) {
+                    result.kickers[result.kicker_count++] = static_cast<Rank>(r + 1);
+                    ++groups[n];
+                    rankMask |= 1U << r;
+                }
+            }
+        }
+
+        const bool straight = isSequential(rankMask);
+        if (straight && flush)                      result.rank = HandRank::StraightFlush;
+        else if (groups[4] == 1)                    result.rank = HandRank::FourOfKind;
+        else if (groups[3] == 1 && groups[2] == 1)  result.rank = HandRank::FullHouse;
+        else if (flush)                             result.rank = HandRank::Flush;
+        else if (straight)                          result.rank = HandRank::Straight;
+        else if (groups[3] == 1)                    result.rank = HandRank::ThreeOfKind;
+        else if (groups[2] == 2)                    result.rank = HandRank::TwoPair;
+        else if (groups[2] == 1)                    result.rank = HandRank::OnePair;
+        return result;
+    }
+
+    // 点数掩码（第 rank-1 位）是否是5个连续的点数
+    // A 只算 1：A-2-3-4-5 是最小的顺子，没有 10-J-Q-K-A
+    static constexpr bool isSequential(std::uint32_t rankMask) noexcept {
+        return std::popcount(rankMask) == static_cast<int>(Hand::HAND_SIZE) &&
+               (rankMask >> std::countr_zero(rankMask)) == 0x1F;
+    }
+
+    // 查表评估一手牌，返回牌力值（无内存分配，适合大规模模拟）
+    static HandStrength evaluate_strength(const Hand& hand);
+    static HandStrength evaluate_strength(const PackedHand& hand);
+    static HandStrength evaluate_strength(const HandState& state);
+
+    // 7张牌（德州扑克）中最好的5张的牌力值，直接查表，不枚举21种组合
+    // cardMask 为 PackedHand::mask 布局的64位牌掩码，不是7张牌时返回0
+    static HandStrength evaluate_strength7(std::uint64_t cardMask);
+    static HandStrength evaluate_strength7(std::span<const PackedCard> cards);
+
+    // 批量查表评估：strengths[i] = evaluate_strength(hands[i])
+    // 支持 AVX2 的 CPU 上每次迭代评估8手牌，否则逐手评估（运行时检测）
+    static void evaluate_batch(std::span<const PackedHand> hands, std::span<HandStrength> strengths);
+
+    // 牌力值对应的牌型
+    static HandRank strength_to_rank(HandStrength strength);
+
+    // 评估比较分值（HandComparator 的完整比较规则，包括花色比较）
+    static HandScore evaluate_score(const Hand& hand);
+    static HandScore evaluate_score(const PackedHand& hand);
+    static HandScore evaluate_score(const HandState& state);
+
+    // 比较分值中的牌力值部分
+    static constexpr HandStrength score_to_strength(HandScore score) noexcept {
+        return static_cast<HandStrength>(score >> SCORE_SUIT_BITS);
+    }
+
+    static constexpr unsigned SCORE_SUIT_BITS = 2;
+
     // 判断是否有对子
     static bool hasPair(const Hand& hand);
 
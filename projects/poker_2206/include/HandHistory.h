@@ -0,0 +1,157 @@
+#pragma once
+
+#include "Hand.h"
+#include "HandEvaluator.h"
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Poker {
+
+// 一局两人牌局的完整记录
+struct HandHistoryRecord {
+    static constexpr size_t PLAYERS = 2;
+
+    std::array<std::array<std::uint8_t, Hand::HAND_SIZE>, PLAYERS> dealt{};        // 发到的牌（序号 0..51）
+    std::array<std::array<std::uint8_t, Hand::HAND_SIZE>, PLAYERS> final_hands{};  // 换牌后的牌
+    std::array<DiscardMask, PLAYERS> discards{};
+    std::array<HandScore, PLAYERS> scores{};
+    std::uint8_t winner = 0;  // 0 平局，1 玩家1，2 玩家2（有人弃牌时为另一方）
+};
+
+// 牌局记录文件的格式（小端）
+//
+// 文件头 16 字节，之后是定长的块，每块 BLOCK_ROUNDS 局，按列存放：
+//   块头 16 字节 { uint32 局数, uint32 保留, uint64 第一局的序号 }
+//   scores[0], scores[1]      每局 2 字节
+//   dealt[0], dealt[1]        每局 5 字节
+//   final_hands[0], [1]       每局 5 字节
+//   discards[0], discards[1]  每局 1 字节
+//   winner                    每局 1 字节
+// 块按定长写出，但不一定写满：flush() 会把未满的块写出，之后的记录从新的一块开始，
+// 因此文件中间也可能有不满的块。按块头的局数读取，按块头的第一局序号定位某一局。
+// 按列存放时扫描一列只读这一列的字节
+namespace HandHistoryFormat {
+
+constexpr std::array<char, 8> MAGIC = {'P', 'K', 'R', 'H', 'I', 'S', 'T', '1'};
+constexpr size_t FILE_HEADER_BYTES = 16;
+constexpr size_t BLOCK_ROUNDS = 4096;
+constexpr size_t BLOCK_HEADER_BYTES = 16;
+
+constexpr size_t PLAYERS = HandHistoryRecord::PLAYERS;
+constexpr size_t CARDS = Hand::HAND_SIZE;
+
+constexpr size_t scores_offset(size_t player) { return BLOCK_HEADER_BYTES + player * BLOCK_ROUNDS * sizeof(HandScore); }
+constexpr size_t dealt_offset(size_t player) { return scores_offset(PLAYERS) + player * BLOCK_ROUNDS * CARDS; }
+constexpr size_t final_offset(size_t player) { return dealt_offset(PLAYERS) + player * BLOCK_ROUNDS * CARDS; }
+constexpr size_t discards_offset(size_t player) { return final_offset(PLAYERS) + player * BLOCK_ROUNDS; }
+constexpr size_t WINNER_OFFSET = discards_offset(PLAYERS);
+constexpr size_t BLOCK_BYTES = WINNER_OFFSET + BLOCK_ROUNDS;
+
+} // namespace HandHistoryFormat
+
+// 流式写入器
+//
+// 记录先追加到内存中的当前块（各列分开存放），块满后交给后台线程，
+// 后台线程用一次 writev 把各列依次写出；写出期间另一块继续接收记录（双缓冲）。
+// append 是线程安全的，多线程模拟时各线程先攒一批再追加，减少加锁次数
+class HandHistoryWriter {
+public:
+    // 创建（覆盖）文件，失败时抛出 std::runtime_error
+    explicit HandHistoryWriter(const std::string& path);
+
+    // 写出剩余的记录并关闭文件
+    ~HandHistoryWriter();
+
+    HandHistoryWriter(const HandHistoryWriter&) = delete;
+    HandHistoryWriter& operator=(const HandHistoryWriter&) = delete;
+
+    void append(const HandHistoryRecord& record);
+    void append(std::span<const HandHistoryRecord> records);
+
+    // 把未满的块也写出，并等待写完；后台写入出错时在这里（或下一次 append）抛出
+    // 之后追加的记录从新的一块开始
+    void flush();
+
+    [[nodiscard]] std::uint64_t rounds() const;
+
+private:
+    struct Block;
+
+    void append_locked(const HandHistoryRecord& record, std::unique_lock<std::mutex>& lock);
+    void submit_locked(std::unique_lock<std::mutex>& lock);
+    void wait_written_locked(std::unique_lock<std::mutex>& lock);
+    void write_loop();
+    void write_block(const Block& block);
+
+    int fd_ = -1;
+    std::array<std::unique_ptr<Block>, 2> blocks_;
+    size_t active_ = 0;          // 正在接收记录的块
+    Block* writing_ = nullptr;   // 交给后台线程、尚未写完的块
+    std::uint64_t rounds_ = 0;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+    std::exception_ptr error_;
+    std::thread thread_;
+};
+
+// 一块记录的列视图（直接指向映射的文件内容）
+struct HandHistoryBlock {
+    std::uint64_t first_round = 0;
+    size_t count = 0;
+
+    std::array<std::span<const HandScore>, HandHistoryRecord::PLAYERS> scores;
+    std::array<std::span<const std::uint8_t>, HandHistoryRecord::PLAYERS> dealt;        // 每局5字节
+    std::array<std::span<const std::uint8_t>, HandHistoryRecord::PLAYERS> final_hands;  // 每局5字节
+    std::array<std::span<const DiscardMask>, HandHistoryRecord::PLAYERS> discards;
+    std::span<const std::uint8_t> winners;
+};
+
+// 基于 mmap 的只读读取器
+class HandHistoryReader {
+public:
+    // 映射整个文件并检查格式（文件头和每个块头），失败时抛出 std::runtime_error
+    explicit HandHistoryReader(const std::string& path);
+    ~HandHistoryReader();
+
+    HandHistoryReader(const HandHistoryReader&) = delete;
+    HandHistoryReader& operator=(const HandHistoryReader&) = delete;
+
+    [[nodiscard]] std::uint64_t size() const noexcept { return rounds_; }
+    [[nodiscard]] size_t block_count() const noexcept { return blocks_; }
+
+    [[nodiscard]] HandHistoryBlock block(size_t index) const;
+
+    // 按序号还原一局的完整记录（按各块的第一局序号二分查找所在的块）
+    [[nodiscard]] HandHistoryRecord record(std::uint64_t round) const;
+
+    // 对每一块调用 visit(const HandHistoryBlock&)
+    template <typename Visitor>
+    void scan(Visitor&& visit) const {
+        for (size_t b = 0; b < blocks_; ++b) {
+            visit(block(b));
+        }
+    }
+
+    // 列扫描：玩家 player（0 或 1）换了 drawn 张牌、且独赢（won）或没赢的所有局的序号
+    // 只读取该玩家的换牌列和胜者列
+    [[nodiscard]] std::vector<std::uint64_t> find_rounds(size_t player, int drawn, bool won) const;
+
+private:
+    const std::byte* data_ = nullptr;
+    size_t bytes_ = 0;
+    size_t blocks_ = 0;
+    std::uint64_t rounds_ = 0;
+    std::vector<std::uint64_t> firstRounds_;  // 每块第一局的序号（严格递增）
+};
+
+} // namespace Poker
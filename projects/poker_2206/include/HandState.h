@@ -0,0 +1,98 @@
+#pragma once
+
+#include "PackedCard.h"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace Poker {
+
+// 可增量更新的评估状态
+//
+// 保存一手牌的点数直方图、各花色张数、点数位掩码、点数质数之积和64位牌掩码（与 PackedHand::mask 相同的布局），
+// 加一张牌、去掉一张牌都是 O(1)，HandEvaluator 直接用这些值查表评估，不需要从头重新统计。
+// 换一两张牌后重新评估时只更新被换的牌。要求手牌中没有重复的牌
+class HandState {
+public:
+    constexpr HandState() = default;
+
+    constexpr explicit HandState(std::span<const PackedCard> cards) noexcept {
+        for (const auto& card : cards) {
+            add_card(card);
+        }
+    }
+
+    constexpr void add_card(PackedCard card) noexcept {
+        ++rankCounts_[card.rank_index()];
+        ++suitCounts_[static_cast<unsigned>(card.get_suit())];
+        rankMask_ |= card.rank_bit();
+        primeProduct_ *= card.prime();
+        mask_ |= card.mask_bit();
+        ++size_;
+    }
+
+    constexpr void remove_card(PackedCard card) noexcept {
+        if (--rankCounts_[card.rank_index()] == 0) {
+            rankMask_ &= ~card.rank_bit();
+        }
+        --suitCounts_[static_cast<unsigned>(card.get_suit())];
+        primeProduct_ /= card.prime();  // 质数之积一定能整除
+        mask_ &= ~card.mask_bit();
+        --size_;
+    }
+
+    constexpr void replace_card(PackedCard removed, PackedCard added) noexcept {
+        remove_card(removed);
+        add_card(added);
+    }
+
+    constexpr void clear() noexcept { *this = HandState(); }
+
+    [[nodiscard]] constexpr size_t size() const noexcept { return size_; }
+
+    // 某个点数的张数
+    [[nodiscard]] constexpr unsigned rank_count(Rank rank) const noexcept {
+        return rankCounts_[static_cast<unsigned>(rank) - 1];
+    }
+
+    // 某种花色的张数
+    [[nodiscard]] constexpr unsigned suit_count(Suit suit) const noexcept {
+        return suitCounts_[static_cast<unsigned>(suit)];
+    }
+
+    // 所有出现过的点数（第 rank-1 位）
+    [[nodiscard]] constexpr std::uint32_t rank_mask() const noexcept { return rankMask_; }
+
+    // 点数质数之积（查有重复点数的表用）
+    [[nodiscard]] constexpr std::uint32_t prime_product() const noexcept { return primeProduct_; }
+
+    // 64位牌掩码
+    [[nodiscard]] constexpr std::uint64_t mask() const noexcept { return mask_; }
+
+    // 所有牌是否同一花色（至少2张）
+    [[nodiscard]] constexpr bool is_flush() const noexcept {
+        return size_ >= 2 && suitCounts_[std::countr_zero(mask_) / 16] == size_;
+    }
+
+    // 指定点数的牌中最大的花色（HandComparator 的花色比较规则），没有该点数时返回 nullopt
+    [[nodiscard]] constexpr std::optional<Suit> highest_suit_of(Rank rank) const noexcept {
+        constexpr std::uint64_t RANK_COLUMN = 0x0001000100010001;
+        const std::uint64_t column = mask_ & (RANK_COLUMN << (static_cast<unsigned>(rank) - 1));
+        if (column == 0) {
+            return std::nullopt;
+        }
+        return static_cast<Suit>((63 - std::countl_zero(column)) / 16);
+    }
+
+private:
+    std::uint64_t mask_ = 0;
+    std::uint32_t rankMask_ = 0;
+    std::uint32_t primeProduct_ = 1;
+    std::array<std::uint8_t, 13> rankCounts_{};
+    std::array<std::uint8_t, 4> suitCounts_{};
+    std::uint8_t size_ = 0;
+};
+
+} // namespace Poker
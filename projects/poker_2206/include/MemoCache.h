@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Poker {
+
+// 并发记忆化缓存
+//
+// 按键的哈希分成 NumShards 个分片，每个分片一把读写锁：
+// 命中时只取共享锁，不同分片的写入互不阻塞。
+// 值在计算期间不持有锁，两个线程同时未命中同一个键时可能各算一次，先写入的结果保留
+template <typename Key, typename Value, typename Hash = std::hash<Key>, size_t NumShards = 64>
+class MemoCache {
+public:
+    [[nodiscard]] std::optional<Value> find(const Key& key) const {
+        const Shard& shard = shard_for(key);
+        std::shared_lock lock(shard.mutex);
+        const auto it = shard.entries.find(key);
+        if (it == shard.entries.end()) {
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return it->second;
+    }
+
+    // 插入（已存在时保留原值），返回缓存中的值
+    Value insert(const Key& key, const Value& value) {
+        Shard& shard = shard_for(key);
+        std::unique_lock lock(shard.mutex);
+        return shard.entries.try_emplace(key, value).first->second;
+    }
+
+    // 命中时返回缓存的值，否则调用 compute() 计算并写入
+    template <typename Compute>
+    Value get_or_compute(const Key& key, Compute&& compute) {
+        if (auto cached = find(key)) {
+            return *cached;
+        }
+        return insert(key, std::forward<Compute>(compute)());
+    }
+
+    void clear() {
+        for (auto& shard : shards_) {
+            std::unique_lock lock(shard.mutex);
+            shard.entries.clear();
+        }
+    }
+
+    [[nodiscard]] size_t size() const {
+        size_t total = 0;
+        for (const auto& shard : shards_) {
+            std::shared_lock lock(shard.mutex);
+            total += shard.entries.size();
+        }
+        return total;
+    }
+
+    [[nodiscard]] std::uint64_t hits() const noexcept { return hits_.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t misses() const noexcept { return misses_.load(std::memory_order_relaxed); }
+
+private:
+    // 每个分片独占缓存行，避免相邻分片的锁互相干扰
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<Key, Value, Hash> entries;
+    };
+
+    // 用哈希的高位选分片，低位留给分片内的哈希表
+    Shard& shard_for(const Key& key) { return shards_[shard_index(key)]; }
+    const Shard& shard_for(const Key& key) const { return shards_[shard_index(key)]; }
+
+    static size_t shard_index(const Key& key) {
+        const std::uint64_t h = static_cast<std::uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(h >> 58) % NumShards;
+    }
+
+    std::array<Shard, NumShards> shards_;
+    mutable std::atomic<std::uint64_t> hits_{0};
+    mutable std::atomic<std::uint64_t> misses_{0};
+};
+
+} // namespace Poker
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Card.h"
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace Poker {
+
+// 32位紧凑编码的扑克牌（Cactus Kev 布局）
+//
+// +--------+--------+--------+--------+
+// |xxxbbbbb|bbbbbbbb|SCDHrrrr|xxpppppp|
+// +--------+--------+--------+--------+
+// b = 点数位（第 rank-1 位），SCDH = 花色位（H=红桃 ... S=黑桃）
+// r = 点数下标（0..12），p = 点数对应的质数
+//
+// 评估时只需要位运算：同花 = 5张牌花色位相与不为0，点数掩码 = 点数位相或，质数之积 = p 相乘
+class PackedCard {
+public:
+    static constexpr std::array<std::uint32_t, 13> RANK_PRIMES = {
+        2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41
+    };
+
+    constexpr PackedCard() = default;
+
+    constexpr PackedCard(Suit suit, Rank rank) noexcept {
+        const auto r = static_cast<std::uint32_t>(rank) - 1;
+        const auto s = static_cast<std::uint32_t>(suit);
+        bits_ = (1U << (16 + r)) | (1U << (12 + s)) | (r << 8) | RANK_PRIMES[r];
+    }
+
+    explicit PackedCard(const Card& card) noexcept
+        : PackedCard(card.get_suit(), card.get_rank()) {}
+
+    // 由牌的序号（0..51，花色 * 13 + 点数下标）构造
+    [[nodiscard]] static constexpr PackedCard from_index(unsigned index) noexcept {
+        return PackedCard(static_cast<Suit>(index / 13), static_cast<Rank>(index % 13 + 1));
+    }
+
+    [[nodiscard]] constexpr std::uint32_t bits() const noexcept { return bits_; }
+    [[nodiscard]] constexpr std::uint32_t rank_bit() const noexcept { return bits_ >> 16; }
+    [[nodiscard]] constexpr std::uint32_t suit_bit() const noexcept { return (bits_ >> 12) & 0xF; }
+    [[nodiscard]] constexpr std::uint32_t rank_index() const noexcept { return (bits_ >> 8) & 0xF; }
+    [[nodiscard]] constexpr std::uint32_t prime() const noexcept { return bits_ & 0x3F; }
+
+    [[nodiscard]] constexpr Rank get_rank() const noexcept {
+        return static_cast<Rank>(rank_index() + 1);
+    }
+
+    [[nodiscard]] constexpr Suit get_suit() const noexcept {
+        return static_cast<Suit>(std::countr_zero(suit_bit()));
+    }
+
+    // 牌的序号（0..51）
+    [[nodiscard]] constexpr unsigned index() const noexcept {
+        return static_cast<unsigned>(get_suit()) * 13 + rank_index();
+    }
+
+    // 在64位牌掩码中的位置：每种花色占16位，低13位是点数
+    [[nodiscard]] constexpr std::uint64_t mask_bit() const noexcept {
+        return std::uint64_t{1} << (static_cast<unsigned>(get_suit()) * 16 + rank_index());
+    }
+
+    [[nodiscard]] constexpr bool is_valid() const noexcept { return bits_ != 0; }
+
+    [[nodiscard]] Card to_card() const { return Card(get_suit(), get_rank()); }
+
+    constexpr bool operator==(const PackedCard& other) const noexcept = default;
+
+private:
+    std::uint32_t bits_ = 0;
+};
+
+} // namespace Poker
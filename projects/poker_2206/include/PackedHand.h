@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Hand.h"
+#include "PackedCard.h"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace Poker {
+
+// 定长、无堆分配的手牌
+//
+// 同时保存：
+// - 按位置排列的紧凑牌（换牌需要知道位置）
+// - 64位牌掩码：每种花色占16位，低13位为点数位，便于按花色/点数做位运算
+class PackedHand {
+public:
+    static constexpr size_t CAPACITY = Hand::HAND_SIZE;
+    static constexpr std::uint64_t SUIT_LANE = 0x1FFF;             // 一种花色的13个点数位
+    static constexpr std::uint64_t RANK_COLUMN = 0x0001000100010001; // 同一点数在4种花色中的位
+
+    constexpr PackedHand() = default;
+
+    explicit PackedHand(const Hand& hand) noexcept {
+        for (const auto& card : hand.get_cards()) {
+            add_card(PackedCard(card));
+        }
+    }
+
+    // 添加牌（已满时忽略）
+    constexpr void add_card(PackedCard card) noexcept {
+        if (size_ < CAPACITY) {
+            cards_[size_++] = card;
+            mask_ |= card.mask_bit();
+        }
+    }
+
+    // 替换指定位置的牌
+    constexpr void replace_card(size_t index, PackedCard card) noexcept {
+        if (index < size_) {
+            mask_ &= ~cards_[index].mask_bit();
+            cards_[index] = card;
+            mask_ |= card.mask_bit();
+        }
+    }
+
+    constexpr void clear() noexcept {
+        size_ = 0;
+        mask_ = 0;
+    }
+
+    [[nodiscard]] constexpr size_t size() const noexcept { return size_; }
+    [[nodiscard]] constexpr bool is_full() const noexcept { return size_ == CAPACITY; }
+    [[nodiscard]] constexpr PackedCard operator[](size_t index) const noexcept { return cards_[index]; }
+
+    [[nodiscard]] constexpr std::span<const PackedCard> get_cards() const noexcept {
+        return {cards_.data(), size_};
+    }
+
+    // 64位牌掩码
+    [[nodiscard]] constexpr std::uint64_t mask() const noexcept { return mask_; }
+
+    // 某种花色的13位点数掩码
+    [[nodiscard]] constexpr std::uint32_t suit_mask(Suit suit) const noexcept {
+        return static_cast<std::uint32_t>((mask_ >> (static_cast<unsigned>(suit) * 16)) & SUIT_LANE);
+    }
+
+    // 所有出现过的点数
+    [[nodiscard]] constexpr std::uint32_t rank_mask() const noexcept {
+        return static_cast<std::uint32_t>((mask_ | mask_ >> 16 | mask_ >> 32 | mask_ >> 48) & SUIT_LANE);
+    }
+
+    // 指定点数的牌中最大的花色（HandComparator 的花色比较规则），没有该点数时返回 nullopt
+    [[nodiscard]] constexpr std::optional<Suit> highest_suit_of(Rank rank) const noexcept {
+        const std::uint64_t column = mask_ & (RANK_COLUMN << (static_cast<unsigned>(rank) - 1));
+        if (column == 0) {
+            return std::nullopt;
+        }
+        return static_cast<Suit>((63 - std::countl_zero(column)) / 16);
+    }
+
+    // 是否包含某张牌
+    [[nodiscard]] constexpr bool contains(PackedCard card) const noexcept {
+        return (mask_ & card.mask_bit()) != 0;
+    }
+
+    // 转换回普通手牌
+    [[nodiscard]] Hand to_hand() const {
+        Hand hand;
+        for (size_t i = 0; i < size_; ++i) {
+            hand.add_card(cards_[i].to_card());
+        }
+        return hand;
+    }
+
+private:
+    std::array<PackedCard, CAPACITY> cards_{};
+    std::uint64_t mask_ = 0;
+    std::uint8_t size_ = 0;
+};
+
+} // namespace Poker
@@ -3,11 +3,22 @@
 #include "Hand.h"
 #include "Deck.h"
 #include "HandEvaluator.h"
+#include "PackedHand.h"
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace Poker {
 
+// 换牌后一轮固定下注额的下注历史（玩家1先行动，每人最多下注或跟注一次）
+enum class BetHistory : std::uint8_t {
+    Root,      // 玩家1：过牌 / 下注
+    Checked,   // 玩家1过牌，庄家：过牌 / 下注
+    Bet,       // 玩家1下注，庄家：弃牌 / 跟注
+    CheckBet   // 过牌-下注，玩家1：弃牌 / 跟注
+};
+
 class Player {
 public:
     explicit Player(const std::string& name);
@@ -17,8 +28,22 @@ public:
     [[nodiscard]] Hand& get_hand() noexcept { return hand_; }
     [[nodiscard]] const Hand& get_hand() const noexcept { return hand_; }
 
-    // 决定要换哪些牌（返回要换掉的牌的索引）
-    virtual std::vector<size_t> decide_cards_to_replace() = 0;
+    // 决定要换哪些牌（返回换牌掩码，第 i 位 = 第 i 张牌）
+    virtual DiscardMask decide_discards() = 0;
+
+    // 决定要换哪些牌（返回要换掉的牌的索引，按升序）
+    std::vector<size_t> decide_cards_to_replace();
+
+    // 换牌后的下注：返回 true 表示下注（面对下注时为跟注），false 表示过牌（面对下注时为弃牌）
+    // opponentDraws 是对手换牌的张数（公开信息）
+    // 默认从不主动下注、面对下注时总是跟注
+    virtual bool decide_bet(BetHistory history, size_t opponentDraws);
+
+    // 复制一个策略相同的玩家（多线程模拟时每个线程各用一份）
+    [[nodiscard]] virtual std::unique_ptr<Player> clone() const = 0;
+
+    // 是否需要控制台交互（无界面模式不能使用）
+    [[nodiscard]] virtual bool is_interactive() const noexcept { return false; }
 
     // 显示手牌
     void show_hand(bool hideCards = false) const;
@@ -33,25 +58,45 @@ class HumanPlayer : public Player {
 public:
     explicit HumanPlayer(const std::string& name);
 
-    std::vector<size_t> decide_cards_to_replace() override;
+    DiscardMask decide_discards() override;
+    bool decide_bet(BetHistory history, size_t opponentDraws) override;
+    [[nodiscard]] std::unique_ptr<Player> clone() const override;
+    [[nodiscard]] bool is_interactive() const noexcept override { return true; }
+};
+
+// AI玩家的换牌策略
+enum class DiscardStrategy {
+    Heuristic,  // 经验规则（接近同花/顺子、保留对子等）
+    Optimal,    // 穷举所有换牌方式，选期望牌力最高的（DrawOptimizer）
+    StandPat    // 从不换牌（模拟对比用的基准）
 };
 
 // AI玩家（庄家）
 class AIPlayer : public Player {
 public:
-    explicit AIPlayer(const std::string& name);
+    explicit AIPlayer(const std::string& name, DiscardStrategy strategy = DiscardStrategy::Heuristic);
 
-    std::vector<size_t> decide_cards_to_replace() override;
+    DiscardMask decide_discards() override;
 
-private:
-    // 根据牌的质量决定换牌策略
-    std::vector<size_t> analyze_hand();
+    // 下注规则：两对及以上下注，面对下注时有对子就跟注
+    bool decide_bet(BetHistory history, size_t opponentDraws) override;
+
+    [[nodiscard]] std::unique_ptr<Player> clone() const override;
+
+    [[nodiscard]] DiscardStrategy get_strategy() const noexcept { return strategy_; }
 
-    // 检查是否接近同花
-    [[nodiscard]] bool is_almost_flush() const;
+    // 换牌策略（无内存分配）：返回要换掉的牌的位置掩码（第 i 位 = 第 i 张牌）
+    static DiscardMask choose_discards(const PackedHand& hand);
 
-    // 检查是否接近顺子
-    [[nodiscard]] bool is_almost_straight() const;
+    // 已有增量评估状态时不再重新统计（state 必须与 hand 一致）
+    static DiscardMask choose_discards(const PackedHand& hand, const HandState& state);
+    static DiscardMask choose_discards(const Hand& hand);
+
+private:
+    DiscardStrategy strategy_;
+
+    // 根据牌的质量决定换牌策略
+    DiscardMask analyze_hand() const;
 };
 
 } // namespace Poker
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+
+namespace Poker {
+
+// 模拟用的随机数发生器
+//
+// 都满足 UniformRandomBitGenerator，可以直接用于标准库的分布，也可以作为 Deck 的随机数策略：
+// - Xoshiro256StarStar：64位输出，速度最快，jump() 可以切出互不重叠的并行流
+// - Pcg32：32位输出，状态只有16字节，stream 参数选择独立的序列
+// - Philox4x32：基于计数器，第 n 个输出只由 (key, n) 决定，并行流可以精确复现
+
+// SplitMix64：把一个64位种子扩展成多个状态字
+class SplitMix64 {
+public:
+    using result_type = std::uint64_t;
+
+    constexpr explicit SplitMix64(std::uint64_t seed = 0) noexcept : state_(seed) {}
+
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    constexpr result_type operator()() noexcept {
+        std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+private:
+    std::uint64_t state_;
+};
+
+// xoshiro256**（Blackman & Vigna）
+class Xoshiro256StarStar {
+public:
+    using result_type = std::uint64_t;
+
+    constexpr explicit Xoshiro256StarStar(std::uint64_t seed = 0) noexcept {
+        this->seed(seed);
+    }
+
+    constexpr void seed(std::uint64_t seed) noexcept {
+        SplitMix64 mixer(seed);
+        for (auto& word : state_) {
+            word = mixer();
+        }
+    }
+
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    constexpr result_type operator()() noexcept {
+        const std::uint64_t result = std::rotl(state_[1] * 5, 7) * 9;
+        const std::uint64_t t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = std::rotl(state_[3], 45);
+        return result;
+    }
+
+    // 相当于调用 2^128 次 operator()：从同一个种子切出互不重叠的并行流
+    constexpr void jump() noexcept {
+        constexpr std::uint64_t JUMP[] = {
+            0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+        };
+        std::array<std::uint64_t, 4> jumped{};
+        for (const std::uint64_t word : JUMP) {
+            for (int bit = 0; bit < 64; ++bit) {
+                if (word & (std::uint64_t{1} << bit)) {
+                    for (size_t i = 0; i < jumped.size(); ++i) {
+                        jumped[i] ^= state_[i];
+                    }
+                }
+                (*this)();
+            }
+        }
+        state_ = jumped;
+    }
+
+private:
+    std::array<std::uint64_t, 4> state_{};
+};
+
+// PCG32（XSH-RR 输出，O'Neill）
+class Pcg32 {
+public:
+    using result_type = std::uint32_t;
+
+    constexpr explicit Pcg32(std::uint64_t seed = 0, std::uint64_t stream = 0) noexcept {
+        this->seed(seed, stream);
+    }
+
+    constexpr void seed(std::uint64_t seed, std::uint64_t stream = 0) noexcept {
+        state_ = 0;
+        increment_ = (stream << 1) | 1;
+        (*this)();
+        state_ += seed;
+        (*this)();
+    }
+
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    constexpr result_type operator()() noexcept {
+        const std::uint64_t old = state_;
+        state_ = old * 6364136223846793005ULL + increment_;
+        const auto xorshifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+        return std::rotr(xorshifted, static_cast<int>(old >> 59));
+    }
+
+private:
+    std::uint64_t state_ = 0;
+    std::uint64_t increment_ = 1;
+};
+
+// Philox4x32-10（Salmon 等，Random123）
+//
+// 输出 = 以 key 为密钥对128位计数器做10轮乘法-异或。
+// 种子决定 key，stream 占计数器的高64位，每个流都可以从任意位置精确复现
+class Philox4x32 {
+public:
+    using result_type = std::uint32_t;
+
+    constexpr explicit Philox4x32(std::uint64_t seed = 0, std::uint64_t stream = 0) noexcept {
+        this->seed(seed, stream);
+    }
+
+    constexpr void seed(std::uint64_t seed, std::uint64_t stream = 0) noexcept {
+        key_ = {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+        counter_ = {0, 0, static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)};
+        index_ = BLOCK_SIZE;
+    }
+
+    // 跳到流中第 position 个输出
+    constexpr void set_position(std::uint64_t position) noexcept {
+        const std::uint64_t block = position / BLOCK_SIZE;
+        counter_[0] = static_cast<std::uint32_t>(block);
+        counter_[1] = static_cast<std::uint32_t>(block >> 32);
+        output_ = generate(counter_, key_);
+        increment_counter();
+        index_ = static_cast<unsigned>(position % BLOCK_SIZE);
+    }
+
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    constexpr result_type operator()() noexcept {
+        if (index_ == BLOCK_SIZE) {
+            output_ = generate(counter_, key_);
+            increment_counter();
+            index_ = 0;
+        }
+        return output_[index_++];
+    }
+
+private:
+    static constexpr unsigned BLOCK_SIZE = 4;
+    using Block = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+
+    static constexpr Block generate(Block counter, Key key) noexcept {
+        for (int round = 0; round < 10; ++round) {
+            const std::uint64_t p0 = std::uint64_t{0xD2511F53} * counter[0];
+            const std::uint64_t p1 = std::uint64_t{0xCD9E8D57} * counter[2];
+            counter = {
+                static_cast<std::uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+                static_cast<std::uint32_t>(p1),
+                static_cast<std::uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+                static_cast<std::uint32_t>(p0),
+            };
+            key[0] += 0x9E3779B9;
+            key[1] += 0xBB67AE85;
+        }
+        return counter;
+    }
+
+    // 只递增低64位（块序号），高64位是流编号
+    constexpr void increment_counter() noexcept {
+        if (++counter_[0] == 0) {
+            ++counter_[1];
+        }
+    }
+
+    Key key_{};
+    Block counter_{};
+    Block output_{};
+    unsigned index_ = BLOCK_SIZE;
+};
+
+// 取32位随机数（64位发生器取高32位，质量更好）
+template <typename Rng>
+constexpr std::uint32_t next_u32(Rng& rng) noexcept {
+    if constexpr (sizeof(typename Rng::result_type) >= sizeof(std::uint64_t)) {
+        return static_cast<std::uint32_t>(rng() >> 32);
+    } else {
+        return static_cast<std::uint32_t>(rng());
+    }
+}
+
+// [0, range) 内均匀分布的整数（Lemire 的乘法取高位法）
+// 绝大多数情况只需一次乘法，只有落在很小的偏差区间时才需要一次取模并重新抽取
+template <typename Rng>
+constexpr std::uint32_t bounded(Rng& rng, std::uint32_t range) noexcept {
+    std::uint64_t m = std::uint64_t{next_u32(rng)} * range;
+    auto low = static_cast<std::uint32_t>(m);
+    if (low < range) {
+        const std::uint32_t threshold = (0U - range) % range;
+        while (low < threshold) {
+            m = std::uint64_t{next_u32(rng)} * range;
+            low = static_cast<std::uint32_t>(m);
+        }
+    }
+    return static_cast<std::uint32_t>(m >> 32);
+}
+
+// 部分 Fisher-Yates：只把前 count 个位置洗成均匀随机，其余位置保持未定
+// 只需要发 count 张牌时，比完整洗牌少做 size - count 次交换
+template <typename T, typename Rng>
+constexpr void partial_shuffle(std::span<T> items, size_t count, Rng& rng) noexcept {
+    const size_t n = items.size();
+    for (size_t i = 0; i < count && i + 1 < n; ++i) {
+        const size_t j = i + bounded(rng, static_cast<std::uint32_t>(n - i));
+        std::swap(items[i], items[j]);
+    }
+}
+
+} // namespace Poker
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Hand.h"
+#include "PackedHand.h"
+#include "Player.h"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Poker {
+
+// 范围对范围胜率计算的参数
+struct RangeEquityOptions {
+    DiscardStrategy strategy = DiscardStrategy::Heuristic;  // 双方的换牌策略
+
+    // 一组对局的换牌组合数不超过该值时穷举，否则蒙特卡洛
+    std::uint64_t exhaustive_limit = 1'000'000;
+    std::uint64_t monte_carlo_trials = 20'000;  // 蒙特卡洛时每组对局模拟的牌局数
+
+    size_t threads = 0;     // 线程数，0 表示使用全部核心
+    size_t tile_size = 16;  // 分块边长：每个任务计算 tile_size x tile_size 组对局
+    std::uint64_t seed = 0; // 随机种子，0 表示每次使用不同的种子
+};
+
+// 一组对局（范围1中的一手牌 对 范围2中的一手牌）的结果，从范围1一方看
+struct MatchupResult {
+    std::uint64_t wins = 0;
+    std::uint64_t ties = 0;
+    std::uint64_t losses = 0;
+    bool exhaustive = false;  // 是否为穷举的精确结果
+
+    [[nodiscard]] std::uint64_t trials() const noexcept { return wins + ties + losses; }
+
+    // 两手牌有相同的牌，不可能同时出现
+    [[nodiscard]] bool blocked() const noexcept { return trials() == 0; }
+
+    // 胜率：获胜 + 平局的一半
+    [[nodiscard]] double equity() const noexcept;
+};
+
+// 胜负矩阵：第 row 行第 col 列为范围1第 row 手牌对范围2第 col 手牌
+class RangeEquityMatrix {
+public:
+    RangeEquityMatrix(size_t rows, size_t cols) : rows_(rows), cols_(cols), cells_(rows * cols) {}
+
+    [[nodiscard]] size_t rows() const noexcept { return rows_; }
+    [[nodiscard]] size_t cols() const noexcept { return cols_; }
+
+    [[nodiscard]] MatchupResult& at(size_t row, size_t col) noexcept { return cells_[row * cols_ + col]; }
+    [[nodiscard]] const MatchupResult& at(size_t row, size_t col) const noexcept {
+        return cells_[row * cols_ + col];
+    }
+
+    // 范围1整体的胜率：所有可能对局的胜率按等权平均（跳过有相同牌的对局）
+    [[nodiscard]] double equity() const noexcept;
+
+    // 范围1第 row 手牌对整个范围2的胜率
+    [[nodiscard]] double row_equity(size_t row) const noexcept;
+
+private:
+    size_t rows_;
+    size_t cols_;
+    std::vector<MatchupResult> cells_;
+};
+
+// 五张换牌扑克的范围对范围胜率
+//
+// 范围是一组起手牌（发到手的5张牌）。每组对局中双方按 strategy 换一次牌后比牌，
+// 比较规则与 HandComparator 相同（包括牌力相同时比花色）。
+//
+// 双方换牌后补的牌来自剩余42张牌：所有补牌组合数不超过 exhaustive_limit 时穷举，
+// 否则蒙特卡洛。矩阵按 tile_size 分块，每块是一个任务，交给工作窃取线程池；
+// 同一块内的对局共享几手牌的预处理结果，留在缓存里
+class RangeEquity {
+public:
+    static RangeEquityMatrix calculate(std::span<const Hand> range1, std::span<const Hand> range2,
+                                       const RangeEquityOptions& options = {});
+    static RangeEquityMatrix calculate(std::span<const PackedHand> range1, std::span<const PackedHand> range2,
+                                       const RangeEquityOptions& options = {});
+
+    // 单组对局
+    static MatchupResult matchup(const PackedHand& hand1, const PackedHand& hand2,
+                                 const RangeEquityOptions& options = {});
+};
+
+} // namespace Poker
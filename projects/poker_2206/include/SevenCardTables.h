@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Deck.h"
+#include "HandEvaluator.h"
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace Poker {
+
+// 7张牌（德州扑克）评估器的预计算表
+//
+// 不枚举21种5张组合，直接查表：
+// - 同花：7张牌中某种花色至少5张时，不可能同时有葫芦或四条，
+//   以该花色的13位点数掩码为下标查 flush7 表（表中已是其中最好的5张）
+// - 否则：以点数计数为键（每个点数3位，可逐张相加），经两级完美哈希查 rank7 表，
+//   表中是这个点数组合里最好的5张（不考虑同花）的牌力值
+//
+// 表在首次使用时由5张牌的 EvaluatorTables 生成
+class SevenCardTables {
+public:
+    static constexpr size_t HAND_SIZE = 7;
+    static constexpr size_t BUCKET_BITS = 14;
+    static constexpr size_t BUCKETS = 1 << BUCKET_BITS;
+    static constexpr size_t SLOTS = 1 << 16;  // 点数组合共 49,205 种
+
+    // 获取全局唯一的表（首次调用时生成，线程安全）
+    static const SevenCardTables& instance();
+
+    // 7张牌的牌力值，cardMask 为 PackedHand::mask 布局的64位牌掩码
+    [[nodiscard]] HandStrength evaluate(std::uint64_t cardMask) const noexcept {
+        const auto lane = [cardMask](unsigned suit) {
+            return static_cast<std::uint32_t>((cardMask >> (suit * 16)) & PackedHand::SUIT_LANE);
+        };
+        const std::uint32_t l0 = lane(0), l1 = lane(1), l2 = lane(2), l3 = lane(3);
+
+        for (const std::uint32_t l : {l0, l1, l2, l3}) {
+            if (std::popcount(l) >= 5) {
+                return flush_[l];
+            }
+        }
+        return rank(spread_[l0] + spread_[l1] + spread_[l2] + spread_[l3]);
+    }
+
+    // 按点数计数键查表（键 = 每个点数的张数 << 3 * 点数下标）
+    [[nodiscard]] HandStrength rank(std::uint64_t rankKey) const noexcept {
+        const std::uint64_t h = mix(rankKey);
+        const std::uint64_t bucket = h >> (64 - BUCKET_BITS);
+        return ranks_[mix(h ^ displace_[bucket]) & (SLOTS - 1)];
+    }
+
+    // 13位点数掩码 -> 点数计数键（每个点数占3位）
+    [[nodiscard]] std::uint64_t spread(std::uint32_t rankMask) const noexcept {
+        return spread_[rankMask];
+    }
+
+    // 64位整数混合函数（SplitMix64 的输出函数，双射），用于完美哈希
+    static constexpr std::uint64_t mix(std::uint64_t x) noexcept {
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    SevenCardTables(const SevenCardTables&) = delete;
+    SevenCardTables& operator=(const SevenCardTables&) = delete;
+
+private:
+    SevenCardTables();
+
+    static constexpr size_t RANK_MASK_SIZE = 1 << Deck::NUM_RANKS;
+
+    std::array<HandStrength, RANK_MASK_SIZE> flush_{};    // 13位点数掩码 -> 最好的同花5张
+    std::array<std::uint64_t, RANK_MASK_SIZE> spread_{};  // 13位点数掩码 -> 点数计数键
+    std::array<std::uint16_t, BUCKETS> displace_{};       // 每个桶的偏移量
+    std::array<HandStrength, SLOTS> ranks_{};             // 完美哈希槽 -> 最好的5张
+};
+
+} // namespace Poker
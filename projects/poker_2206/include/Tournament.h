@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Player.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Poker {
+
+constexpr size_t NUM_DISCARD_STRATEGIES = 3;
+
+// 多桌模拟的参数
+struct TournamentOptions {
+    size_t tables = 1000;                // 桌数
+    size_t min_players = 2;              // 每桌人数在 [min_players, max_players] 中随机
+    size_t max_players = 10;
+    std::uint64_t hands_per_table = 1000;  // 每桌玩的手数
+    size_t threads = 0;                  // 线程数，0 表示使用全部核心
+    std::uint64_t seed = 0;              // 随机种子，0 表示每次使用不同的种子
+
+    // 座位 i 的 AI 使用 strategies[i % strategies.size()]
+    std::vector<DiscardStrategy> strategies = {DiscardStrategy::Heuristic};
+};
+
+// 某种换牌策略的成绩
+struct StrategyStatistics {
+    std::uint64_t seats = 0;  // 参与的手数（每个座位每手记一次）
+    std::uint64_t wins = 0;   // 独赢的手数
+    std::uint64_t ties = 0;   // 平分底池的手数
+
+    [[nodiscard]] double win_rate() const noexcept {
+        return seats == 0 ? 0.0 : static_cast<double>(wins) / static_cast<double>(seats);
+    }
+};
+
+// 多桌模拟的结果
+struct TournamentResult {
+    size_t tables = 0;
+    size_t threads = 0;
+    std::uint64_t hands = 0;         // 所有桌一共玩的手数
+    std::uint64_t player_hands = 0;  // 所有桌所有座位的手数之和
+    std::uint64_t split_pots = 0;
+    std::array<StrategyStatistics, NUM_DISCARD_STRATEGIES> strategies{};  // 按 DiscardStrategy 下标
+
+    double seconds = 0.0;
+    double hands_per_second = 0.0;
+
+    [[nodiscard]] const StrategyStatistics& of(DiscardStrategy strategy) const noexcept {
+        return strategies[static_cast<size_t>(strategy)];
+    }
+};
+
+// 多桌、多人的无界面模拟
+//
+// 每桌 2-10 名 AI，是线程池中一个独立的任务：
+// - 桌上的玩家和座位表从该桌自己的内存池（std::pmr）分配，桌结束时整体释放，
+//   各线程之间不争用全局堆
+// - 每手：发牌、按座位顺序换牌（牌堆不够时后面的玩家少换）、牌力最高者赢，
+//   比较规则与 HandComparator 相同
+// - 每桌在本地统计，结束时用原子加法汇总一次，汇总过程不加锁
+class Tournament {
+public:
+    explicit Tournament(TournamentOptions options = {});
+
+    TournamentResult run();
+
+private:
+    TournamentOptions options_;
+};
+
+} // namespace Poker
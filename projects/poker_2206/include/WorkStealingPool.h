@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Poker {
+
+// 工作窃取线程池
+//
+// 每个工作线程有自己的任务队列：自己从队尾取（后进先出，刚提交的任务数据还在缓存里），
+// 空闲时从其他线程的队头窃取（先进先出，偷走的通常是较大的任务）。
+// 任务耗时不均（例如有的对局能穷举、有的要蒙特卡洛）时，各线程仍然能保持忙碌
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+    // threads 为 0 时使用全部核心
+    explicit WorkStealingPool(size_t threads = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // 提交任务：工作线程内提交时放入本线程队列，否则轮流放入各队列
+    void submit(Task task);
+
+    // 等待所有已提交的任务完成；任务抛出的第一个异常在这里重新抛出
+    // 只能在线程池外调用：任务中调用会等待自己而死锁，因此抛出 std::logic_error（嵌套并行请用 parallel_for）
+    void wait();
+
+    // 对 0..count-1 各执行一次 body(i)，全部完成后返回
+    // 可以在本线程池的任务中嵌套调用：此时只等待本次提交的任务，等待期间调用的工作线程继续执行队列中的任务
+    template <typename Body>
+    void parallel_for(size_t count, Body&& body) {
+        if (!on_worker_thread()) {
+            for (size_t i = 0; i < count; ++i) {
+                submit([&body, i] { body(i); });
+            }
+            wait();
+            return;
+        }
+
+        std::atomic<size_t> remaining{count};
+        std::mutex errorMutex;
+        std::exception_ptr error;
+        for (size_t i = 0; i < count; ++i) {
+            submit([&, i] {
+                try {
+                    body(i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                remaining.fetch_sub(1, std::memory_order_release);
+            });
+        }
+        help_until(remaining);
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    [[nodiscard]] size_t thread_count() const noexcept { return threads_.size(); }
+
+private:
+    struct alignas(64) Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    bool try_pop(size_t self, Task& task);
+    bool try_steal(size_t self, Task& task);
+    void worker_loop(size_t index);
+    void run(Task& task);
+
+    // 当前线程是否是本线程池的工作线程
+    [[nodiscard]] bool on_worker_thread() const noexcept;
+
+    // 工作线程执行队列中的任务（自己的或窃取的），直到 remaining 归零
+    void help_until(const std::atomic<size_t>& remaining);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+
+    std::atomic<size_t> queued_{0};   // 在队列中等待的任务数
+    std::atomic<size_t> pending_{0};  // 已提交、尚未完成的任务数
+    std::atomic<size_t> nextQueue_{0};
+
+    std::mutex stateMutex_;
+    std::condition_variable wakeup_;  // 有新任务或停止
+    std::condition_variable idle_;    // 所有任务完成
+    bool stopping_ = false;
+    std::exception_ptr error_;
+};
+
+} // namespace Poker
@@ -0,0 +1,68 @@
+#include "Canonicalizer.h"
+#include <algorithm>
+
+namespace Poker {
+
+namespace {
+
+// 按点数掩码从大到小排列的花色（稳定排序：掩码相同的花色保持原顺序）
+std::array<unsigned, Deck::NUM_SUITS> sorted_suits(std::uint64_t mask) noexcept {
+    std::array<unsigned, Deck::NUM_SUITS> suits = {0, 1, 2, 3};
+    std::stable_sort(suits.begin(), suits.end(), [mask](unsigned a, unsigned b) {
+        return ((mask >> (a * 16)) & PackedHand::SUIT_LANE) > ((mask >> (b * 16)) & PackedHand::SUIT_LANE);
+    });
+    return suits;
+}
+
+} // namespace
+
+std::uint8_t CanonicalHand::to_canonical(std::uint8_t positions) const noexcept {
+    std::uint8_t result = 0;
+    for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+        if (positions & (1U << order[i])) {
+            result |= static_cast<std::uint8_t>(1U << i);
+        }
+    }
+    return result;
+}
+
+std::uint8_t CanonicalHand::from_canonical(std::uint8_t positions) const noexcept {
+    std::uint8_t result = 0;
+    for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+        if (positions & (1U << i)) {
+            result |= static_cast<std::uint8_t>(1U << order[i]);
+        }
+    }
+    return result;
+}
+
+std::uint64_t Canonicalizer::canonical_key(std::uint64_t mask) noexcept {
+    const auto suits = sorted_suits(mask);
+    std::uint64_t key = 0;
+    for (unsigned i = 0; i < Deck::NUM_SUITS; ++i) {
+        key |= ((mask >> (suits[i] * 16)) & PackedHand::SUIT_LANE) << (i * 16);
+    }
+    return key;
+}
+
+CanonicalHand Canonicalizer::canonicalize(const PackedHand& hand) noexcept {
+    const auto suits = sorted_suits(hand.mask());
+
+    CanonicalHand canonical;
+    for (unsigned i = 0; i < Deck::NUM_SUITS; ++i) {
+        canonical.suit_map[suits[i]] = static_cast<std::uint8_t>(i);
+    }
+
+    std::array<unsigned, Hand::HAND_SIZE> bitIndex{};
+    for (size_t i = 0; i < hand.size(); ++i) {
+        const PackedCard card = hand[i];
+        bitIndex[i] = canonical.suit_map[static_cast<unsigned>(card.get_suit())] * 16 + card.rank_index();
+        canonical.key |= std::uint64_t{1} << bitIndex[i];
+        canonical.order[i] = static_cast<std::uint8_t>(i);
+    }
+    std::sort(canonical.order.begin(), canonical.order.begin() + hand.size(),
+              [&](std::uint8_t a, std::uint8_t b) { return bitIndex[a] < bitIndex[b]; });
+    return canonical;
+}
+
+} // namespace Poker
@@ -0,0 +1,558 @@
+#include "CfrSolver.h"
+#include "Deck.h"
+#include "Game.h"
+#include "HandComparator.h"
+#include "Random.h"
+#include "WorkStealingPool.h"
+#include <algorithm>
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+namespace Poker {
+
+namespace {
+
+constexpr size_t DRAW_ACTIONS = CfrAbstraction::DRAW_ACTIONS;
+constexpr size_t BET_ACTIONS = CfrSolver::BET_ACTIONS;
+constexpr size_t CHUNKS = 16;  // 每次迭代的采样分成固定的块数，合并顺序固定，结果与线程数无关
+constexpr size_t DEALT_CARDS = 2 * Hand::HAND_SIZE;
+
+constexpr std::array<char, 8> CHECKPOINT_MAGIC = {'P', 'K', 'C', 'F', 'R', 'P', '0', '3'};
+
+// 座位：与 Game::play_headless_round 一致，庄家（玩家2）先补牌，玩家1先下注
+constexpr size_t PLAYER1 = 0;
+constexpr size_t DEALER = 1;
+
+constexpr double ANTE = Game::ANTE;
+constexpr double BET_SIZE = Game::BET_SIZE;
+
+size_t draw_index(size_t position, size_t preBucket) noexcept {
+    return (position * CfrAbstraction::PRE_BUCKETS + preBucket) * DRAW_ACTIONS;
+}
+
+size_t bet_infoset(BetHistory history, size_t postBucket, size_t opponentDraws) noexcept {
+    return (static_cast<size_t>(history) * CfrAbstraction::POST_BUCKETS + postBucket) * CfrAbstraction::DRAW_COUNTS +
+           opponentDraws;
+}
+
+size_t bet_index(BetHistory history, size_t postBucket, size_t opponentDraws) noexcept {
+    return CfrSolver::DRAW_ENTRIES + bet_infoset(history, postBucket, opponentDraws) * BET_ACTIONS;
+}
+
+// 在 history 处行动的座位
+size_t bet_actor(BetHistory history) noexcept {
+    return history == BetHistory::Checked || history == BetHistory::Bet ? DEALER : PLAYER1;
+}
+
+// 包含手牌点数最多的5连点数窗口（同样多时取较大的窗口）
+// A 是最小的牌，没有 A 高的顺子，窗口不需要回绕
+std::uint32_t straight_window(std::uint32_t ranks) noexcept {
+    std::uint32_t best = 0x1F;
+    for (unsigned low = 1; low + 5 <= Deck::NUM_RANKS; ++low) {
+        const std::uint32_t window = 0x1FU << low;
+        if (std::popcount(ranks & window) >= std::popcount(ranks & best)) {
+            best = window;
+        }
+    }
+    return best;
+}
+
+// 遗憾匹配：正遗憾值归一化，全为0时均匀分布
+void regret_matching(const float* regrets, float* strategy, size_t actions) noexcept {
+    float total = 0.0F;
+    for (size_t a = 0; a < actions; ++a) {
+        total += std::max(regrets[a], 0.0F);
+    }
+    for (size_t a = 0; a < actions; ++a) {
+        strategy[a] = total > 0.0F ? std::max(regrets[a], 0.0F) / total : 1.0F / static_cast<float>(actions);
+    }
+}
+
+// 一次采样的发牌：双方的桶、每种换牌动作的换牌张数，以及每对换牌动作下双方换牌后的桶和摊牌结果
+struct Deal {
+    std::array<size_t, 2> preBuckets{};
+    std::array<std::array<size_t, DRAW_ACTIONS>, 2> draws{};
+    std::array<size_t, DRAW_ACTIONS> dealerPost{};                            // [庄家动作]
+    std::array<std::array<size_t, DRAW_ACTIONS>, DRAW_ACTIONS> playerPost{};  // [庄家动作][玩家1动作]
+    std::array<std::array<double, DRAW_ACTIONS>, DRAW_ACTIONS> showdown{};    // 玩家1的结果 +1 / 0 / -1
+};
+
+PackedHand apply_draw(PackedHand hand, DiscardMask mask, const PackedCard* stub) noexcept {
+    size_t next = 0;
+    for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+        if (mask & (1U << i)) {
+            hand.replace_card(i, stub[next++]);
+        }
+    }
+    return hand;
+}
+
+// 发牌：前10张是双方的手牌，之后庄家先补牌，玩家1接着补
+Deal sample_deal(Xoshiro256StarStar& rng, std::array<PackedCard, Deck::DECK_SIZE>& cards) {
+    const auto& abstraction = CfrAbstraction::instance();
+    partial_shuffle(std::span<PackedCard>(cards), DEALT_CARDS + 2 * Hand::HAND_SIZE, rng);
+
+    std::array<PackedHand, 2> hands;
+    for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+        hands[PLAYER1].add_card(cards[i]);
+        hands[DEALER].add_card(cards[Hand::HAND_SIZE + i]);
+    }
+    const PackedCard* stub = cards.data() + DEALT_CARDS;
+
+    Deal deal;
+    std::array<std::array<DiscardMask, DRAW_ACTIONS>, 2> masks{};
+    for (size_t p = 0; p < 2; ++p) {
+        deal.preBuckets[p] = abstraction.pre_bucket(hands[p]);
+        for (size_t a = 0; a < DRAW_ACTIONS; ++a) {
+            masks[p][a] = CfrAbstraction::draw_mask(hands[p], static_cast<DrawAction>(a));
+            deal.draws[p][a] = static_cast<size_t>(std::popcount(masks[p][a]));
+        }
+    }
+
+    for (size_t a1 = 0; a1 < DRAW_ACTIONS; ++a1) {
+        const HandScore dealer = HandEvaluator::evaluate_score(apply_draw(hands[DEALER], masks[DEALER][a1], stub));
+        deal.dealerPost[a1] = abstraction.post_bucket(HandEvaluator::score_to_strength(dealer));
+        const PackedCard* rest = stub + deal.draws[DEALER][a1];
+
+        for (size_t a0 = 0; a0 < DRAW_ACTIONS; ++a0) {
+            const HandScore player = HandEvaluator::evaluate_score(apply_draw(hands[PLAYER1], masks[PLAYER1][a0], rest));
+            deal.playerPost[a1][a0] = abstraction.post_bucket(HandEvaluator::score_to_strength(player));
+            deal.showdown[a1][a0] = player > dealer ? 1.0 : (player < dealer ? -1.0 : 0.0);
+        }
+    }
+    return deal;
+}
+
+// 对一次发牌遍历整棵（非机会节点的）博弈树：庄家换牌 -> 玩家1换牌（看不到庄家的动作）-> 下注 -> 摊牌
+// 所有效用都从玩家1的角度计算
+class Traversal {
+public:
+    Traversal(const std::vector<float>& current, std::vector<double>& regretDelta, std::vector<double>& sumDelta)
+        : current_(current), regretDelta_(regretDelta), sumDelta_(sumDelta) {}
+
+    void run(const Deal& deal) {
+        deal_ = &deal;
+
+        // 庄家换牌（根节点）
+        const size_t index = draw_index(DEALER, deal.preBuckets[DEALER]);
+        std::array<double, DRAW_ACTIONS> utilities{};
+        double node = 0.0;
+        for (size_t a1 = 0; a1 < DRAW_ACTIONS; ++a1) {
+            utilities[a1] = player_draw(a1, current_[index + a1]);
+            node += current_[index + a1] * utilities[a1];
+        }
+        update(index, DRAW_ACTIONS, utilities.data(), node, 1.0, 1.0, DEALER);
+    }
+
+private:
+    // 玩家1换牌（信息集只取决于自己的桶）
+    double player_draw(size_t a1, double dealerReach) {
+        const Deal& deal = *deal_;
+        const size_t index = draw_index(PLAYER1, deal.preBuckets[PLAYER1]);
+        std::array<double, DRAW_ACTIONS> utilities{};
+        double node = 0.0;
+        for (size_t a0 = 0; a0 < DRAW_ACTIONS; ++a0) {
+            const Context context{
+                deal.playerPost[a1][a0], deal.dealerPost[a1], deal.draws[PLAYER1][a0], deal.draws[DEALER][a1],
+                deal.showdown[a1][a0]
+            };
+            utilities[a0] = bet(BetHistory::Root, context, current_[index + a0], dealerReach);
+            node += current_[index + a0] * utilities[a0];
+        }
+        update(index, DRAW_ACTIONS, utilities.data(), node, 1.0, dealerReach, PLAYER1);
+        return node;
+    }
+
+    struct Context {
+        size_t playerPost;
+        size_t dealerPost;
+        size_t playerDraws;
+        size_t dealerDraws;
+        double showdown;  // 玩家1摊牌的结果：1 / 0 / -1
+    };
+
+    double bet(BetHistory history, const Context& c, double playerReach, double dealerReach) {
+        const size_t actor = bet_actor(history);
+        const size_t index = actor == PLAYER1 ? bet_index(history, c.playerPost, c.dealerDraws)
+                                              : bet_index(history, c.dealerPost, c.playerDraws);
+        const float* strategy = &current_[index];
+
+        std::array<double, BET_ACTIONS> utilities{};
+        for (size_t a = 0; a < BET_ACTIONS; ++a) {
+            const double r0 = actor == PLAYER1 ? playerReach * strategy[a] : playerReach;
+            const double r1 = actor == DEALER ? dealerReach * strategy[a] : dealerReach;
+            utilities[a] = child(history, a == 1, c, r0, r1);
+        }
+        const double node = strategy[0] * utilities[0] + strategy[1] * utilities[1];
+        update(index, BET_ACTIONS, utilities.data(), node, playerReach, dealerReach, actor);
+        return node;
+    }
+
+    // 动作 0 = 过牌 / 弃牌，1 = 下注 / 跟注；结算与 Game::betting_round 相同
+    double child(BetHistory history, bool aggressive, const Context& c, double playerReach, double dealerReach) {
+        switch (history) {
+            case BetHistory::Root:
+                return bet(aggressive ? BetHistory::Bet : BetHistory::Checked, c, playerReach, dealerReach);
+            case BetHistory::Checked:
+                return aggressive ? bet(BetHistory::CheckBet, c, playerReach, dealerReach) : c.showdown * ANTE;
+            case BetHistory::Bet:
+                return aggressive ? c.showdown * (ANTE + BET_SIZE) : ANTE;
+            case BetHistory::CheckBet:
+                return aggressive ? c.showdown * (ANTE + BET_SIZE) : -ANTE;
+        }
+        return 0.0;
+    }
+
+    // 遗憾值按对手的到达概率加权，策略累计值按自己的到达概率加权
+    void update(size_t index, size_t actions, const double* utilities, double node,
+                double playerReach, double dealerReach, size_t actor) {
+        const double sign = actor == PLAYER1 ? 1.0 : -1.0;
+        const double opponentReach = actor == PLAYER1 ? dealerReach : playerReach;
+        const double ownReach = actor == PLAYER1 ? playerReach : dealerReach;
+        for (size_t a = 0; a < actions; ++a) {
+            regretDelta_[index + a] += opponentReach * sign * (utilities[a] - node);
+            sumDelta_[index + a] += ownReach * current_[index + a];
+        }
+    }
+
+    const std::vector<float>& current_;
+    std::vector<double>& regretDelta_;
+    std::vector<double>& sumDelta_;
+    const Deal* deal_ = nullptr;
+};
+
+// 平均策略：策略累计值按信息集归一化
+std::vector<float> normalize(const float* sums, size_t infosets, size_t actions) {
+    std::vector<float> probabilities(infosets * actions);
+    for (size_t i = 0; i < infosets; ++i) {
+        const float* s = sums + i * actions;
+        const float total = std::accumulate(s, s + actions, 0.0F);
+        for (size_t a = 0; a < actions; ++a) {
+            probabilities[i * actions + a] = total > 0.0F ? s[a] / total : 1.0F / static_cast<float>(actions);
+        }
+    }
+    return probabilities;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// CfrAbstraction
+
+const CfrAbstraction& CfrAbstraction::instance() {
+    static const CfrAbstraction abstraction;
+    return abstraction;
+}
+
+CfrAbstraction::CfrAbstraction() {
+    // 全部5张牌手牌的牌力分布
+    std::array<std::uint32_t, STRENGTH_VALUES> counts{};
+    PackedHand hand;
+    for (unsigned a = 0; a < Deck::DECK_SIZE; ++a) {
+        for (unsigned b = a + 1; b < Deck::DECK_SIZE; ++b) {
+            for (unsigned c = b + 1; c < Deck::DECK_SIZE; ++c) {
+                for (unsigned d = c + 1; d < Deck::DECK_SIZE; ++d) {
+                    for (unsigned e = d + 1; e < Deck::DECK_SIZE; ++e) {
+                        hand.clear();
+                        for (unsigned index : {a, b, c, d, e}) {
+                            hand.add_card(PackedCard::from_index(index));
+                        }
+                        ++counts[HandEvaluator::evaluate_strength(hand)];
+                    }
+                }
+            }
+        }
+    }
+
+    // 换牌前：高牌和一对按类内百分位（取同一牌力值区间的中点）再细分，两对及以上每种牌型一个桶（成牌与听牌的换法完全不同）
+    // 换牌后：按整体百分位分桶
+    constexpr std::array<size_t, 9> SUB_BUCKETS = {4, 5, 1, 1, 1, 1, 1, 1, 1};
+    static_assert(SUB_BUCKETS[0] + SUB_BUCKETS[1] + 7 == STRENGTH_BUCKETS);
+
+    std::array<double, SUB_BUCKETS.size()> categoryTotals{};
+    for (size_t s = 1; s < STRENGTH_VALUES; ++s) {
+        categoryTotals[static_cast<size_t>(HandEvaluator::strength_to_rank(static_cast<HandStrength>(s)))] += counts[s];
+    }
+
+    const double total = std::accumulate(counts.begin(), counts.end(), 0.0);
+    double below = 0.0;
+    std::array<double, SUB_BUCKETS.size()> categoryBelow{};
+    for (size_t s = 1; s < STRENGTH_VALUES; ++s) {
+        const auto category = static_cast<size_t>(HandEvaluator::strength_to_rank(static_cast<HandStrength>(s)));
+        const size_t offset = std::accumulate(SUB_BUCKETS.begin(), SUB_BUCKETS.begin() + category, size_t{0});
+        const double within = (categoryBelow[category] + 0.5 * counts[s]) / categoryTotals[category];
+        strengthBuckets_[s] = static_cast<std::uint8_t>(
+            offset + std::min<size_t>(SUB_BUCKETS[category] - 1, static_cast<size_t>(within * SUB_BUCKETS[category])));
+
+        const double percentile = (below + 0.5 * counts[s]) / total;
+        postBuckets_[s] = static_cast<std::uint8_t>(std::min<double>(POST_BUCKETS - 1, percentile * POST_BUCKETS));
+
+        below += counts[s];
+        categoryBelow[category] += counts[s];
+    }
+}
+
+size_t CfrAbstraction::pre_bucket(const PackedHand& hand) const noexcept {
+    const HandStrength strength = HandEvaluator::evaluate_strength(hand);
+    const HandRank rank = HandEvaluator::strength_to_rank(strength);
+
+    bool flushDraw = false;
+    for (unsigned suit = 0; suit < Deck::NUM_SUITS; ++suit) {
+        flushDraw = flushDraw || std::popcount(hand.suit_mask(static_cast<Suit>(suit))) == 4;
+    }
+    // 两头或中间缺一张的顺子听牌
+    const bool straightDraw =
+        rank < HandRank::Straight && std::popcount(hand.rank_mask() & straight_window(hand.rank_mask())) == 4;
+
+    return strengthBuckets_[strength] * 4 + (flushDraw ? 2 : 0) + (straightDraw ? 1 : 0);
+}
+
+DiscardMask CfrAbstraction::draw_mask(const PackedHand& hand, DrawAction action) noexcept {
+    const auto cards = hand.get_cards();
+
+    if (action == DrawAction::StandPat) {
+        return 0;
+    }
+
+    if (action == DrawAction::StraightDraw) {
+        // 窗口内每个点数保留一张，其余（窗口外的和重复点数的）都换掉
+        std::uint32_t keep = straight_window(hand.rank_mask());
+        DiscardMask mask = 0;
+        for (size_t i = 0; i < cards.size(); ++i) {
+            const std::uint32_t bit = 1U << cards[i].rank_index();
+            if (keep & bit) {
+                keep &= ~bit;
+            } else {
+                mask |= static_cast<DiscardMask>(1U << i);
+            }
+        }
+        return mask;
+    }
+
+    if (action == DrawAction::FlushDraw) {
+        unsigned bestSuit = 0;
+        for (unsigned suit = 1; suit < Deck::NUM_SUITS; ++suit) {
+            if (std::popcount(hand.suit_mask(static_cast<Suit>(suit))) >=
+                std::popcount(hand.suit_mask(static_cast<Suit>(bestSuit)))) {
+                bestSuit = suit;
+            }
+        }
+        DiscardMask mask = 0;
+        for (size_t i = 0; i < cards.size(); ++i) {
+            if (static_cast<unsigned>(cards[i].get_suit()) != bestSuit) {
+                mask |= static_cast<DiscardMask>(1U << i);
+            }
+        }
+        return mask;
+    }
+
+    // 按（同点数张数, 点数）排序，换掉最弱的几张
+    std::array<int, Deck::NUM_RANKS> rankCounts{};
+    for (const auto& card : cards) {
+        rankCounts[card.rank_index()]++;
+    }
+    std::array<std::pair<std::uint32_t, size_t>, Hand::HAND_SIZE> order{};
+    for (size_t i = 0; i < cards.size(); ++i) {
+        order[i] = {static_cast<std::uint32_t>(rankCounts[cards[i].rank_index()]) * 16 + cards[i].rank_index(), i};
+    }
+    std::sort(order.begin(), order.begin() + cards.size());
+
+    const size_t discards = static_cast<size_t>(action);  // Draw1..Draw4 的值即张数
+    DiscardMask mask = 0;
+    for (size_t i = 0; i < discards && i < cards.size(); ++i) {
+        mask |= static_cast<DiscardMask>(1U << order[i].second);
+    }
+    return mask;
+}
+
+// ---------------------------------------------------------------------------
+// CfrStrategy
+
+CfrStrategy::CfrStrategy(std::vector<float> drawProbabilities, std::vector<float> betProbabilities)
+    : drawProbabilities_(std::move(drawProbabilities)), betProbabilities_(std::move(betProbabilities)) {
+    if (drawProbabilities_.size() != CfrSolver::DRAW_ENTRIES ||
+        betProbabilities_.size() != CfrSolver::BET_INFOSETS) {
+        throw std::invalid_argument("CFR 策略表大小不正确");
+    }
+
+    bestDraws_.resize(CfrSolver::DRAW_INFOSETS);
+    for (size_t i = 0; i < CfrSolver::DRAW_INFOSETS; ++i) {
+        const auto begin = drawProbabilities_.begin() + static_cast<std::ptrdiff_t>(i * DRAW_ACTIONS);
+        bestDraws_[i] = static_cast<DrawAction>(std::max_element(begin, begin + DRAW_ACTIONS) - begin);
+    }
+}
+
+DrawAction CfrStrategy::draw_action(size_t position, const PackedHand& hand) const noexcept {
+    return bestDraws_[position * CfrAbstraction::PRE_BUCKETS + CfrAbstraction::instance().pre_bucket(hand)];
+}
+
+float CfrStrategy::draw_probability(size_t position, size_t preBucket, DrawAction action) const noexcept {
+    return drawProbabilities_[draw_index(position, preBucket) + static_cast<size_t>(action)];
+}
+
+float CfrStrategy::bet_probability(BetHistory history, size_t postBucket, size_t opponentDraws) const noexcept {
+    return betProbabilities_[bet_infoset(history, postBucket, opponentDraws)];
+}
+
+// ---------------------------------------------------------------------------
+// CfrSolver
+
+CfrSolver::CfrSolver(CfrOptions options)
+    : options_(std::move(options)),
+      seed_(options_.seed != 0 ? options_.seed
+                               : (std::uint64_t{std::random_device{}()} << 32) | std::random_device{}()),
+      regrets_(TABLE_SIZE, 0.0F),
+      strategySums_(TABLE_SIZE, 0.0F) {}
+
+void CfrSolver::train() {
+    WorkStealingPool pool(options_.threads);
+    for (std::uint64_t i = 0; i < options_.iterations; ++i) {
+        iterate(pool);
+        if (!options_.checkpoint_path.empty() && options_.checkpoint_interval != 0 &&
+            iteration_ % options_.checkpoint_interval == 0) {
+            save_checkpoint(options_.checkpoint_path);
+        }
+    }
+    if (!options_.checkpoint_path.empty()) {
+        save_checkpoint(options_.checkpoint_path);
+    }
+}
+
+void CfrSolver::iterate(WorkStealingPool& pool) {
+    // 本次迭代的当前策略（遍历期间只读，各块共享）
+    std::vector<float> current(TABLE_SIZE);
+    for (size_t i = 0; i < DRAW_INFOSETS; ++i) {
+        regret_matching(&regrets_[i * DRAW_ACTIONS], &current[i * DRAW_ACTIONS], DRAW_ACTIONS);
+    }
+    for (size_t i = 0; i < BET_INFOSETS; ++i) {
+        const size_t offset = DRAW_ENTRIES + i * BET_ACTIONS;
+        regret_matching(&regrets_[offset], &current[offset], BET_ACTIONS);
+    }
+
+    std::vector<std::vector<double>> regretDeltas(CHUNKS, std::vector<double>(TABLE_SIZE, 0.0));
+    std::vector<std::vector<double>> sumDeltas(CHUNKS, std::vector<double>(TABLE_SIZE, 0.0));
+    const std::uint64_t samples = options_.samples_per_iteration;
+
+    pool.parallel_for(CHUNKS, [&](size_t chunk) {
+        SplitMix64 seeds(seed_ ^ ((iteration_ * CHUNKS + chunk) * 0xD1B54A32D192ED03ULL));
+        Xoshiro256StarStar rng(seeds());
+
+        std::array<PackedCard, Deck::DECK_SIZE> cards;
+        for (unsigned i = 0; i < Deck::DECK_SIZE; ++i) {
+            cards[i] = PackedCard::from_index(i);
+        }
+
+        Traversal traversal(current, regretDeltas[chunk], sumDeltas[chunk]);
+        const std::uint64_t begin = samples * chunk / CHUNKS;
+        const std::uint64_t end = samples * (chunk + 1) / CHUNKS;
+        for (std::uint64_t s = begin; s < end; ++s) {
+            traversal.run(sample_deal(rng, cards));
+        }
+    });
+
+    // CFR+：遗憾值截断为非负；平均策略按迭代次数线性加权
+    ++iteration_;
+    const double weight = static_cast<double>(iteration_);
+    for (size_t i = 0; i < TABLE_SIZE; ++i) {
+        double regret = regrets_[i];
+        double sum = 0.0;
+        for (size_t chunk = 0; chunk < CHUNKS; ++chunk) {
+            regret += regretDeltas[chunk][i];
+            sum += sumDeltas[chunk][i];
+        }
+        regrets_[i] = static_cast<float>(std::max(regret, 0.0));
+        strategySums_[i] += static_cast<float>(weight * sum);
+    }
+}
+
+void CfrSolver::save_checkpoint(const std::string& path) const {
+    // 先写临时文件再改名，中途中断时不会留下半个检查点
+    const std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        const std::uint64_t size = TABLE_SIZE;
+        out.write(CHECKPOINT_MAGIC.data(), CHECKPOINT_MAGIC.size());
+        out.write(reinterpret_cast<const char*>(&iteration_), sizeof(iteration_));
+        out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        out.write(reinterpret_cast<const char*>(regrets_.data()),
+                  static_cast<std::streamsize>(regrets_.size() * sizeof(float)));
+        out.write(reinterpret_cast<const char*>(strategySums_.data()),
+                  static_cast<std::streamsize>(strategySums_.size() * sizeof(float)));
+        if (!out) {
+            throw std::runtime_error("无法写入检查点 " + temporary);
+        }
+    }
+    std::filesystem::rename(temporary, path);
+}
+
+void CfrSolver::load_checkpoint(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    std::array<char, 8> magic{};
+    std::uint64_t iteration = 0;
+    std::uint64_t size = 0;
+    in.read(magic.data(), magic.size());
+    in.read(reinterpret_cast<char*>(&iteration), sizeof(iteration));
+    in.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!in || magic != CHECKPOINT_MAGIC || size != TABLE_SIZE) {
+        throw std::runtime_error("检查点格式错误: " + path);
+    }
+
+    std::vector<float> regrets(TABLE_SIZE);
+    std::vector<float> sums(TABLE_SIZE);
+    in.read(reinterpret_cast<char*>(regrets.data()), static_cast<std::streamsize>(TABLE_SIZE * sizeof(float)));
+    in.read(reinterpret_cast<char*>(sums.data()), static_cast<std::streamsize>(TABLE_SIZE * sizeof(float)));
+    if (!in) {
+        throw std::runtime_error("检查点不完整: " + path);
+    }
+
+    iteration_ = iteration;
+    regrets_ = std::move(regrets);
+    strategySums_ = std::move(sums);
+}
+
+std::shared_ptr<const CfrStrategy> CfrSolver::strategy() const {
+    std::vector<float> draws = normalize(strategySums_.data(), DRAW_INFOSETS, DRAW_ACTIONS);
+    const std::vector<float> bets = normalize(strategySums_.data() + DRAW_ENTRIES, BET_INFOSETS, BET_ACTIONS);
+
+    std::vector<float> aggressive(BET_INFOSETS);
+    for (size_t i = 0; i < BET_INFOSETS; ++i) {
+        aggressive[i] = bets[i * BET_ACTIONS + 1];
+    }
+    return std::make_shared<const CfrStrategy>(std::move(draws), std::move(aggressive));
+}
+
+// ---------------------------------------------------------------------------
+// CfrPlayer
+
+CfrPlayer::CfrPlayer(const std::string& name, std::shared_ptr<const CfrStrategy> strategy, size_t position)
+    : Player(name), strategy_(std::move(strategy)), position_(position) {
+    if (!strategy_ || position_ > 1) {
+        throw std::invalid_argument("CfrPlayer 需要策略和座位（0 或 1）");
+    }
+}
+
+DiscardMask CfrPlayer::decide_discards() {
+    const PackedHand hand(hand_);
+    return CfrAbstraction::draw_mask(hand, strategy_->draw_action(position_, hand));
+}
+
+bool CfrPlayer::decide_bet(BetHistory history, size_t opponentDraws) {
+    const PackedHand hand(hand_);
+    const size_t postBucket = CfrAbstraction::instance().post_bucket(HandEvaluator::evaluate_strength(hand));
+    const float probability = strategy_->bet_probability(history, postBucket, opponentDraws);
+
+    // 同一手牌在同一局面下总是做同样的选择，同一个桶内的不同手牌按概率混合
+    SplitMix64 mixer(hand.mask() ^ (static_cast<std::uint64_t>(history) << 56) ^ (std::uint64_t{opponentDraws} << 60));
+    const double uniform = static_cast<double>(mixer() >> 11) * 0x1.0p-53;
+    return uniform < probability;
+}
+
+std::unique_ptr<Player> CfrPlayer::clone() const {
+    return std::make_unique<CfrPlayer>(name_, strategy_, position_);
+}
+
+} // namespace Poker
@@ -0,0 +1,155 @@
+#include "DrawOptimizer.h"
+#include "Canonicalizer.h"
+#include "Deck.h"
+#include "EvaluatorTables.h"
+#include "MemoCache.h"
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace Poker {
+
+namespace {
+
+constexpr size_t STUB_SIZE = Deck::DECK_SIZE - Hand::HAND_SIZE;
+constexpr std::uint32_t SUIT_BITS = 0xF000;
+
+// 逐张累加的部分手牌：质数之积、点数位或、花色位与
+struct PartialHand {
+    std::uint32_t product;
+    std::uint32_t rankBits;
+    std::uint32_t suitBits;
+
+    [[nodiscard]] PartialHand with(PackedCard card) const noexcept {
+        return {product * card.prime(), rankBits | card.bits(), suitBits & card.bits()};
+    }
+};
+
+HandStrength lookup(const EvaluatorTables& tables, const PartialHand& hand) noexcept {
+    const std::uint32_t rankMask = hand.rankBits >> 16;
+    if ((hand.suitBits & SUIT_BITS) != 0) {
+        return tables.flush(rankMask);
+    }
+    if (std::popcount(rankMask) == static_cast<int>(Hand::HAND_SIZE)) {
+        return tables.unique5(rankMask);
+    }
+    return tables.paired(hand.product);
+}
+
+// 从 stub[from..] 中再选 Depth 张补牌，累加所有组合的牌力值
+template <int Depth>
+std::uint64_t accumulate(const EvaluatorTables& tables, const std::array<PackedCard, STUB_SIZE>& stub,
+                         size_t from, const PartialHand& hand) noexcept {
+    if constexpr (Depth == 0) {
+        return lookup(tables, hand);
+    } else {
+        std::uint64_t sum = 0;
+        for (size_t i = from; i + Depth <= STUB_SIZE; ++i) {
+            sum += accumulate<Depth - 1>(tables, stub, i + 1, hand.with(stub[i]));
+        }
+        return sum;
+    }
+}
+
+std::uint64_t accumulate(const EvaluatorTables& tables, const std::array<PackedCard, STUB_SIZE>& stub,
+                         int draws, const PartialHand& hand) noexcept {
+    switch (draws) {
+        case 0: return accumulate<0>(tables, stub, 0, hand);
+        case 1: return accumulate<1>(tables, stub, 0, hand);
+        case 2: return accumulate<2>(tables, stub, 0, hand);
+        case 3: return accumulate<3>(tables, stub, 0, hand);
+        case 4: return accumulate<4>(tables, stub, 0, hand);
+        default: return accumulate<5>(tables, stub, 0, hand);
+    }
+}
+
+// 组合数 C(n, k)
+constexpr std::uint64_t choose(std::uint64_t n, std::uint64_t k) noexcept {
+    std::uint64_t result = 1;
+    for (std::uint64_t i = 1; i <= k; ++i) {
+        result = result * (n - k + i) / i;
+    }
+    return result;
+}
+
+// 按规范牌序保存的换牌结果
+using CanonicalExpectations = std::array<double, DrawDecision::NUM_DISCARDS>;
+
+MemoCache<std::uint64_t, CanonicalExpectations>& decision_cache() {
+    static MemoCache<std::uint64_t, CanonicalExpectations> cache;
+    return cache;
+}
+
+std::uint8_t best_of(const std::array<double, DrawDecision::NUM_DISCARDS>& expected) {
+    // 期望相同时选换牌张数少的，张数也相同时选掩码小的
+    std::uint8_t best = 0;
+    for (std::uint8_t mask = 1; mask < DrawDecision::NUM_DISCARDS; ++mask) {
+        if (expected[mask] > expected[best] ||
+            (expected[mask] == expected[best] && std::popcount(mask) < std::popcount(best))) {
+            best = mask;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+DrawDecision DrawOptimizer::enumerate(const PackedHand& hand) {
+    if (!hand.is_full() || std::popcount(hand.mask()) != static_cast<int>(Hand::HAND_SIZE)) {
+        throw std::invalid_argument("需要5张不同的牌");
+    }
+
+    std::array<PackedCard, STUB_SIZE> stub{};
+    size_t count = 0;
+    for (unsigned index = 0; index < Deck::DECK_SIZE; ++index) {
+        const PackedCard card = PackedCard::from_index(index);
+        if (!hand.contains(card)) {
+            stub[count++] = card;
+        }
+    }
+
+    const auto& tables = EvaluatorTables::instance();
+    DrawDecision decision;
+    for (unsigned discards = 0; discards < DrawDecision::NUM_DISCARDS; ++discards) {
+        PartialHand kept{1, 0, SUIT_BITS};
+        for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+            if (!(discards & (1U << i))) {
+                kept = kept.with(hand[i]);
+            }
+        }
+
+        const int draws = std::popcount(discards);
+        const std::uint64_t sum = accumulate(tables, stub, draws, kept);
+        decision.expected_strength[discards] =
+            static_cast<double>(sum) / static_cast<double>(choose(STUB_SIZE, static_cast<std::uint64_t>(draws)));
+    }
+    decision.best_discards = best_of(decision.expected_strength);
+    return decision;
+}
+
+DrawDecision DrawOptimizer::optimize(const PackedHand& hand) {
+    if (!hand.is_full()) {
+        throw std::invalid_argument("需要5张不同的牌");
+    }
+
+    const CanonicalHand canonical = Canonicalizer::canonicalize(hand);
+    const CanonicalExpectations expectations = decision_cache().get_or_compute(canonical.key, [&] {
+        const DrawDecision computed = enumerate(hand);
+        CanonicalExpectations result{};
+        for (unsigned discards = 0; discards < DrawDecision::NUM_DISCARDS; ++discards) {
+            result[canonical.to_canonical(static_cast<std::uint8_t>(discards))] =
+                computed.expected_strength[discards];
+        }
+        return result;
+    });
+
+    DrawDecision decision;
+    for (unsigned discards = 0; discards < DrawDecision::NUM_DISCARDS; ++discards) {
+        decision.expected_strength[discards] =
+            expectations[canonical.to_canonical(static_cast<std::uint8_t>(discards))];
+    }
+    decision.best_discards = best_of(decision.expected_strength);
+    return decision;
+}
+
+} // namespace Poker
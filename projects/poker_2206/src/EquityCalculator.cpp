@@ -0,0 +1,259 @@
+#include "EquityCalculator.h"
+#include "Canonicalizer.h"
+#include "Deck.h"
+#include "HandComparator.h"
+#include "HandEvaluator.h"
+#include "MemoCache.h"
+#include "Player.h"
+#include "Random.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace Poker {
+
+namespace {
+
+constexpr size_t CACHE_LINE = 64;
+constexpr size_t STUB_SIZE = Deck::DECK_SIZE - Hand::HAND_SIZE;
+
+// 每个线程的统计结果，独占一个缓存行，避免线程之间伪共享
+// 只有所属线程写入（每批一次），收敛检查时其他线程读取
+struct alignas(CACHE_LINE) PartialResult {
+    std::atomic<std::uint64_t> wins{0};
+    std::atomic<std::uint64_t> ties{0};
+    std::atomic<std::uint64_t> losses{0};
+};
+
+double compute_standard_error(std::uint64_t wins, std::uint64_t ties, std::uint64_t trials) {
+    if (trials == 0) {
+        return 0.0;
+    }
+    // 每局的得分为 1 / 0.5 / 0
+    const double n = static_cast<double>(trials);
+    const double mean = (static_cast<double>(wins) + 0.5 * static_cast<double>(ties)) / n;
+    const double meanSquare = (static_cast<double>(wins) + 0.25 * static_cast<double>(ties)) / n;
+    return std::sqrt(std::max(0.0, meanSquare - mean * mean) / n);
+}
+
+// 单个线程的模拟器：持有自己的剩余牌堆和随机数流
+// 评估使用增量状态：我方保留的牌只统计一次，每局只加上补的牌；对手换牌时只更新被换的牌
+class Simulator {
+public:
+    Simulator(const PackedHand& hero, std::uint8_t heroDiscards, std::uint64_t seed, size_t stream)
+        : heroDraws_(std::popcount(heroDiscards)), rng_(seed) {
+        // 同一个种子，每个线程跳到互不重叠的一段
+        for (size_t i = 0; i < stream; ++i) {
+            rng_.jump();
+        }
+
+        for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+            if (!(heroDiscards & (1U << i))) {
+                heroKept_.add_card(hero[i]);
+            }
+        }
+
+        size_t count = 0;
+        for (unsigned index = 0; index < Deck::DECK_SIZE; ++index) {
+            const PackedCard card = PackedCard::from_index(index);
+            if (!hero.contains(card)) {
+                stub_[count++] = card;
+            }
+        }
+    }
+
+    // 模拟一局，返回比较结果（我方为 Hand1）
+    ComparisonResult play() {
+        next_ = 0;
+
+        PackedHand opponent;
+        for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+            opponent.add_card(draw());
+        }
+        HandState opponentState(opponent.get_cards());
+        const std::uint8_t opponentDiscards = AIPlayer::choose_discards(opponent, opponentState);
+
+        HandState hero = heroKept_;
+        for (int i = 0; i < heroDraws_; ++i) {
+            hero.add_card(draw());
+        }
+        for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+            if (opponentDiscards & (1U << i)) {
+                opponentState.replace_card(opponent[i], draw());
+            }
+        }
+
+        return HandComparator::compare_scores(HandEvaluator::evaluate_score(hero),
+                                              HandEvaluator::evaluate_score(opponentState));
+    }
+
+private:
+    // 部分 Fisher-Yates：只打乱需要用到的前几张牌
+    // 牌堆不需要复原，任意排列再部分打乱仍是均匀分布
+    PackedCard draw() {
+        partial_shuffle(std::span<PackedCard>(stub_).subspan(next_), 1, rng_);
+        return stub_[next_++];
+    }
+
+    HandState heroKept_;
+    int heroDraws_;
+    std::array<PackedCard, STUB_SIZE> stub_{};
+    size_t next_ = 0;
+    Xoshiro256StarStar rng_;
+};
+
+// 缓存键：规范手牌 + 影响结果的参数
+struct EquityCacheKey {
+    std::uint64_t hand;
+    std::uint64_t maxTrials;
+    double targetError;
+    int discards;  // 规范牌序下的换牌掩码，-1 表示按策略换牌
+
+    bool operator==(const EquityCacheKey&) const = default;
+};
+
+struct EquityCacheKeyHash {
+    size_t operator()(const EquityCacheKey& key) const noexcept {
+        size_t h = std::hash<std::uint64_t>{}(key.hand);
+        h = h * 31 + std::hash<std::uint64_t>{}(key.maxTrials);
+        h = h * 31 + std::hash<double>{}(key.targetError);
+        return h * 31 + std::hash<int>{}(key.discards);
+    }
+};
+
+MemoCache<EquityCacheKey, EquityResult, EquityCacheKeyHash>& equity_cache() {
+    static MemoCache<EquityCacheKey, EquityResult, EquityCacheKeyHash> cache;
+    return cache;
+}
+
+} // namespace
+
+double EquityResult::win_rate() const noexcept {
+    return trials == 0 ? 0.0 : static_cast<double>(wins) / static_cast<double>(trials);
+}
+
+double EquityResult::tie_rate() const noexcept {
+    return trials == 0 ? 0.0 : static_cast<double>(ties) / static_cast<double>(trials);
+}
+
+double EquityResult::loss_rate() const noexcept {
+    return trials == 0 ? 0.0 : static_cast<double>(losses) / static_cast<double>(trials);
+}
+
+double EquityResult::equity() const noexcept {
+    return win_rate() + 0.5 * tie_rate();
+}
+
+EquityResult EquityCalculator::calculate(const Hand& hero, const EquityOptions& options) {
+    return calculate(PackedHand(hero), options);
+}
+
+EquityResult EquityCalculator::calculate(const PackedHand& hero, const EquityOptions& options) {
+    if (!hero.is_full() || std::popcount(hero.mask()) != static_cast<int>(Hand::HAND_SIZE)) {
+        throw std::invalid_argument("需要5张不同的牌");
+    }
+
+    if (options.use_cache) {
+        const CanonicalHand canonical = Canonicalizer::canonicalize(hero);
+        const EquityCacheKey key{
+            canonical.key, options.max_trials, options.target_error,
+            options.hero_discards ? canonical.to_canonical(*options.hero_discards) : -1
+        };
+        return equity_cache().get_or_compute(key, [&] {
+            EquityOptions uncached = options;
+            uncached.use_cache = false;
+            return calculate(hero, uncached);
+        });
+    }
+
+    const size_t threadCount = options.threads != 0
+        ? options.threads
+        : std::max(1u, std::thread::hardware_concurrency());
+    const std::uint64_t batchSize = std::max<std::uint64_t>(1, options.batch_size);
+    const std::uint64_t seed = options.seed != 0 ? options.seed : std::random_device{}();
+
+    // 我方手牌固定，换牌策略只需计算一次
+    const std::uint8_t heroDiscards = options.hero_discards.value_or(AIPlayer::choose_discards(hero));
+
+    std::vector<PartialResult> partials(threadCount);
+    std::atomic<std::uint64_t> claimed{0};
+    std::atomic<bool> converged{false};
+
+    // 至少每个线程完成一批后才检查收敛，避免样本太少时误判
+    const std::uint64_t minTrials = std::min(options.max_trials, batchSize * threadCount);
+
+    auto worker = [&](size_t index) {
+        Simulator simulator(hero, heroDiscards, seed, index);
+        PartialResult& partial = partials[index];
+        std::uint64_t wins = 0;
+        std::uint64_t ties = 0;
+        std::uint64_t losses = 0;
+
+        while (!converged.load(std::memory_order_relaxed)) {
+            const std::uint64_t start = claimed.fetch_add(batchSize, std::memory_order_relaxed);
+            if (start >= options.max_trials) {
+                break;
+            }
+            const std::uint64_t count = std::min(batchSize, options.max_trials - start);
+
+            for (std::uint64_t i = 0; i < count; ++i) {
+                switch (simulator.play()) {
+                    case ComparisonResult::Hand1Wins: ++wins;   break;
+                    case ComparisonResult::Tie:       ++ties;   break;
+                    case ComparisonResult::Hand2Wins: ++losses; break;
+                }
+            }
+
+            // 每批结束时发布一次本线程的结果
+            partial.wins.store(wins, std::memory_order_relaxed);
+            partial.ties.store(ties, std::memory_order_relaxed);
+            partial.losses.store(losses, std::memory_order_relaxed);
+
+            if (options.target_error > 0.0) {
+                std::uint64_t totalWins = 0;
+                std::uint64_t totalTies = 0;
+                std::uint64_t totalTrials = 0;
+                for (const auto& p : partials) {
+                    const std::uint64_t w = p.wins.load(std::memory_order_relaxed);
+                    const std::uint64_t t = p.ties.load(std::memory_order_relaxed);
+                    totalWins += w;
+                    totalTies += t;
+                    totalTrials += w + t + p.losses.load(std::memory_order_relaxed);
+                }
+                if (totalTrials >= minTrials &&
+                    compute_standard_error(totalWins, totalTies, totalTrials) <= options.target_error) {
+                    converged.store(true, std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i) {
+        threads.emplace_back(worker, i);
+    }
+    worker(0);  // 调用线程也参与计算
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // 合并各线程的结果
+    EquityResult result;
+    for (const auto& partial : partials) {
+        result.wins += partial.wins.load(std::memory_order_relaxed);
+        result.ties += partial.ties.load(std::memory_order_relaxed);
+        result.losses += partial.losses.load(std::memory_order_relaxed);
+    }
+    result.trials = result.wins + result.ties + result.losses;
+    result.standard_error = compute_standard_error(result.wins, result.ties, result.trials);
+    result.converged = converged.load(std::memory_order_relaxed);
+    return result;
+}
+
+} // namespace Poker
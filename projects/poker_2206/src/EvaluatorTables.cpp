@@ -0,0 +1,219 @@
+#include "EvaluatorTables.h"
+#include "PackedCard.h"
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace Poker {
+
+namespace {
+
+constexpr size_t NUM_ENTRIES = HandEvaluator::NUM_STRENGTHS;  // 每种点数组合（区分是否同花）正好一个牌力值
+
+constexpr size_t MAX_BUCKET_KEYS = 16;  // 第一级哈希的一个桶最多容纳的键数（实际远小于此）
+
+using RankCounts = HandEvaluator::RankCounts;
+static_assert(std::tuple_size_v<RankCounts> == Deck::NUM_RANKS);
+
+// 表项的来源：一种点数组合（以及是否同花）
+struct TableEntry {
+    std::uint32_t order = 0;  // 牌型 + kickers 打包成的整数，越大越强
+    std::uint32_t key = 0;    // 同花/无重复：点数掩码；有重复：质数之积
+    bool flush = false;
+    bool unique = false;
+};
+
+// 牌型 + kickers 打包：牌型占高4位，之后每个 kicker 4位（点数 1..13，A 最小），不足5个时低位补0
+// 同一牌型的 kickers 个数相同，整数比较与 HandComparator 逐个比较 kickers 的结果一致
+constexpr std::uint32_t pack(HandRank rank, const std::array<Rank, Hand::HAND_SIZE>& kickers, size_t count) {
+    std::uint32_t order = static_cast<std::uint32_t>(rank);
+    for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+        order = order << 4 | (i < count ? static_cast<std::uint32_t>(kickers[i]) : 0);
+    }
+    return order;
+}
+
+constexpr Rank lead_of(std::uint32_t order) {
+    return static_cast<Rank>((order >> 16) & 0xF);
+}
+
+constexpr HandRank category_of(std::uint32_t order) {
+    return static_cast<HandRank>(order >> 20);
+}
+
+// 牌型和 kickers 取自 HandEvaluator::rank_hand（evaluate 另有独立的实现，poker_bench 逐手核对）
+constexpr TableEntry make_entry(const RankCounts& counts, bool flush) {
+    std::uint32_t mask = 0;
+    std::uint32_t product = 1;
+    for (size_t r = 0; r < Deck::NUM_RANKS; ++r) {
+        for (std::uint8_t copy = 0; copy < counts[r]; ++copy) {
+            product *= PackedCard::RANK_PRIMES[r];
+        }
+        if (counts[r] > 0) {
+            mask |= 1U << r;
+        }
+    }
+
+    const bool unique = std::popcount(mask) == static_cast<int>(Hand::HAND_SIZE);
+    const HandEvaluator::RankedHand ranked = HandEvaluator::rank_hand(counts, flush);
+    return TableEntry{pack(ranked.rank, ranked.kickers, ranked.kicker_count), unique ? mask : product, flush, unique};
+}
+
+// 按打包值从小到大排列的表项下标
+// 打包值只有24位，两趟12位的基数排序；常量求值时比 std::sort 快得多
+constexpr std::array<std::uint16_t, NUM_ENTRIES> sort_by_order(const std::array<TableEntry, NUM_ENTRIES>& entries) {
+    constexpr unsigned DIGIT_BITS = 12;
+    constexpr size_t DIGITS = 1 << DIGIT_BITS;
+
+    std::array<std::uint16_t, NUM_ENTRIES> order{};
+    std::array<std::uint16_t, NUM_ENTRIES> buffer{};
+    for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+        order[i] = static_cast<std::uint16_t>(i);
+    }
+    for (unsigned shift = 0; shift < 2 * DIGIT_BITS; shift += DIGIT_BITS) {
+        std::array<std::uint16_t, DIGITS + 1> start{};
+        for (const TableEntry& entry : entries) {
+            ++start[((entry.order >> shift) & (DIGITS - 1)) + 1];
+        }
+        for (size_t d = 0; d < DIGITS; ++d) {
+            start[d + 1] = static_cast<std::uint16_t>(start[d + 1] + start[d]);
+        }
+        for (const std::uint16_t i : order) {
+            buffer[start[(entries[i].order >> shift) & (DIGITS - 1)]++] = i;
+        }
+        order = buffer;
+    }
+    return order;
+}
+
+// 枚举所有5张牌的点数组合（每个点数最多4张），无重复点数时另加一个同花的表项
+constexpr void enumerate_counts(RankCounts& counts, size_t rank, int remaining,
+                                std::array<TableEntry, NUM_ENTRIES>& entries, size_t& size) {
+    if (rank == Deck::NUM_RANKS) {
+        if (remaining != 0) {
+            return;
+        }
+        const bool unique = std::all_of(counts.begin(), counts.end(), [](std::uint8_t c) { return c <= 1; });
+        entries[size++] = make_entry(counts, false);
+        if (unique) {
+            entries[size++] = make_entry(counts, true);
+        }
+        return;
+    }
+    for (int c = 0; c <= std::min(remaining, 4); ++c) {
+        counts[rank] = static_cast<std::uint8_t>(c);
+        enumerate_counts(counts, rank + 1, remaining - c, entries, size);
+    }
+    counts[rank] = 0;
+}
+
+} // namespace
+
+constexpr EvaluatorTables::EvaluatorTables() {
+    std::array<TableEntry, NUM_ENTRIES> entries{};
+    size_t size = 0;
+    RankCounts counts{};
+    enumerate_counts(counts, 0, static_cast<int>(Hand::HAND_SIZE), entries, size);
+    if (size != NUM_ENTRIES) {
+        throw std::logic_error("点数组合数量与预期不符");
+    }
+
+    // 从弱到强排序，相同牌型和 kickers 的组合共享同一个牌力值
+    const std::array<std::uint16_t, NUM_ENTRIES> order = sort_by_order(entries);
+    std::array<HandStrength, NUM_ENTRIES> strengths{};
+    HandStrength current = 0;
+    for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+        const TableEntry& entry = entries[order[i]];
+        if (i == 0 || entry.order != entries[order[i - 1]].order) {
+            ++current;
+            category_[current] = category_of(entry.order);
+            leadRank_[current] = lead_of(entry.order);
+        }
+        strengths[order[i]] = current;
+    }
+    if (current != HandEvaluator::NUM_STRENGTHS) {
+        throw std::logic_error("牌力值数量与预期不符");
+    }
+
+    // 同花和无重复点数：直接按点数掩码填表
+    // 有重复点数：按第一级哈希的高位分桶（桶内保持枚举顺序，按桶号连续存放）
+    std::array<std::uint16_t, PAIRED_BUCKETS + 1> bucketStart{};
+    for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+        if (entries[i].flush) {
+            flush_[entries[i].key] = strengths[i];
+        } else if (entries[i].unique) {
+            unique5_[entries[i].key] = strengths[i];
+        } else {
+            ++bucketStart[(mix(entries[i].key) >> (32 - PAIRED_BUCKET_BITS)) + 1];
+        }
+    }
+    for (size_t b = 0; b < PAIRED_BUCKETS; ++b) {
+        bucketStart[b + 1] = static_cast<std::uint16_t>(bucketStart[b + 1] + bucketStart[b]);
+    }
+    std::array<std::uint16_t, NUM_ENTRIES> members{};
+    std::array<std::uint16_t, PAIRED_BUCKETS> filled{};
+    for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+        if (!entries[i].flush && !entries[i].unique) {
+            const size_t b = mix(entries[i].key) >> (32 - PAIRED_BUCKET_BITS);
+            members[bucketStart[b] + filled[b]++] = static_cast<std::uint16_t>(i);
+        }
+    }
+
+    // 两级完美哈希：先放大桶（同样大小按桶号），为每个桶寻找一个偏移量，使桶内所有键落到空槽
+    size_t largest = 0;
+    for (size_t b = 0; b < PAIRED_BUCKETS; ++b) {
+        largest = std::max<size_t>(largest, bucketStart[b + 1] - bucketStart[b]);
+    }
+    if (largest > MAX_BUCKET_KEYS) {
+        throw std::logic_error("完美哈希的桶过大");
+    }
+
+    std::array<bool, PAIRED_SLOTS> used{};
+    for (size_t bucketSize = largest; bucketSize > 0; --bucketSize) {
+        for (size_t b = 0; b < PAIRED_BUCKETS; ++b) {
+            if (static_cast<size_t>(bucketStart[b + 1] - bucketStart[b]) != bucketSize) {
+                continue;
+            }
+
+            bool placed = false;
+            std::array<std::uint32_t, MAX_BUCKET_KEYS> slots{};
+            for (std::uint32_t d = 0; d <= 0xFFFF && !placed; ++d) {
+                size_t count = 0;
+                for (; count < bucketSize; ++count) {
+                    const std::uint32_t key = entries[members[bucketStart[b] + count]].key;
+                    const std::uint32_t slot = mix(mix(key) ^ d) & (PAIRED_SLOTS - 1);
+                    if (used[slot] || std::find(slots.begin(), slots.begin() + count, slot) != slots.begin() + count) {
+                        break;
+                    }
+                    slots[count] = slot;
+                }
+                if (count != bucketSize) {
+                    continue;
+                }
+
+                displace_[b] = static_cast<std::uint16_t>(d);
+                for (size_t k = 0; k < bucketSize; ++k) {
+                    used[slots[k]] = true;
+                    paired_[slots[k]] = strengths[members[bucketStart[b] + k]];
+                }
+                placed = true;
+            }
+            if (!placed) {
+                throw std::logic_error("无法构造完美哈希");
+            }
+        }
+    }
+}
+
+const EvaluatorTables& EvaluatorTables::instance() {
+#if POKER_CONSTEXPR_TABLES
+    // 编译期生成，表在只读数据段中：启动时没有生成开销，多个进程通过页缓存共享
+    static constexpr EvaluatorTables tables;
+#else
+    // 首次调用时在运行期生成（线程安全）
+    static const EvaluatorTables tables;
+#endif
+    return tables;
+}
+
+} // namespace Poker
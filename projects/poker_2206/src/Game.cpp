@@ -1,61 +1,183 @@
 #include "Game.h"
-#include "HandComparator.h"
+#include "HandHistory.h"
 #include <iostream>
 #include <algorithm>
+#include <bit>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <thread>
 
 namespace Poker {
 
+namespace {
+
+constexpr size_t HISTORY_BATCH = 1024;  // 模拟线程每攒这么多局追加一次记录
+
+void store_cards(const Hand& hand, std::array<std::uint8_t, Hand::HAND_SIZE>& out) noexcept {
+    const auto cards = hand.get_cards();
+    for (size_t i = 0; i < cards.size(); ++i) {
+        out[i] = static_cast<std::uint8_t>(PackedCard(cards[i]).index());
+    }
+}
+
+} // namespace
+
+void GameStatistics::record(const RoundOutcome& outcome) noexcept {
+    human_units += outcome.player1_units;
+    switch (outcome.result) {
+        case ComparisonResult::Hand1Wins: ++human_wins; break;
+        case ComparisonResult::Hand2Wins: ++ai_wins;    break;
+        case ComparisonResult::Tie:       ++ties;       break;
+    }
+}
+
+GameStatistics& GameStatistics::operator+=(const GameStatistics& other) noexcept {
+    human_wins += other.human_wins;
+    ai_wins += other.ai_wins;
+    ties += other.ties;
+    human_units += other.human_units;
+    return *this;
+}
+
 Game::Game()
     : human_player_(std::make_unique<HumanPlayer>("玩家")),
       ai_player_(std::make_unique<AIPlayer>("庄家")),
-      human_wins_(0),
-      ai_wins_(0),
-      ties_(0) {}
+      mode_(GameMode::Interactive) {}
+
+Game::Game(std::unique_ptr<Player> player1, std::unique_ptr<Player> player2, GameMode mode)
+    : human_player_(std::move(player1)),
+      ai_player_(std::move(player2)),
+      mode_(mode) {
+    if (!human_player_ || !ai_player_) {
+        throw std::invalid_argument("需要两名玩家");
+    }
+    if (mode_ == GameMode::Headless && (human_player_->is_interactive() || ai_player_->is_interactive())) {
+        throw std::invalid_argument("无界面模式不能使用需要交互的玩家");
+    }
+}
 
 void Game::print_separator() const {
     std::cout << "========================================\n";
 }
 
-void Game::deal_cards() {
-    deck_.reset();
-    deck_.shuffle();
-
-    std::cout << "发牌...\n\n";
+void Game::deal_cards(Deck& deck, Player& player1, Player& player2) {
+    deck.reset();
+    // 只洗要发出的10张，换牌时再按需多洗
+    deck.shuffle(Hand::HAND_SIZE * 2);
 
-    human_player_->get_hand().clear();
-    ai_player_->get_hand().clear();
+    player1.get_hand().clear();
+    player2.get_hand().clear();
 
     // 发5张牌给每个玩家
-    for (int i = 0; i < Hand::HAND_SIZE; ++i) {
-        if (auto card = deck_.deal_card()) {
-            human_player_->get_hand().add_card(*card);
+    for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+        if (auto card = deck.deal_card()) {
+            player1.get_hand().add_card(*card);
         }
-        if (auto card = deck_.deal_card()) {
-            ai_player_->get_hand().add_card(*card);
+        if (auto card = deck.deal_card()) {
+            player2.get_hand().add_card(*card);
         }
     }
 }
 
-void Game::replace_cards_phase() {
-    print_separator();
-    std::cout << "换牌阶段\n";
-    print_separator();
+size_t Game::replace_cards(Deck& deck, Player& player, DiscardMask discards) {
+    size_t replaced = 0;
+    for (size_t i = 0; i < player.get_hand().size(); ++i) {
+        if (discards & (1U << i)) {
+            if (auto card = deck.deal_card()) {
+                player.get_hand().replace_card(i, *card);
+                ++replaced;
+            }
+        }
+    }
+    return replaced;
+}
 
-    // AI玩家换牌（不显示过程）
-    auto aiCardsToReplace = ai_player_->decide_cards_to_replace();
-    std::sort(aiCardsToReplace.begin(), aiCardsToReplace.end(), std::greater<size_t>());
+RoundOutcome Game::betting_round(Player& player1, Player& player2, size_t draws1, size_t draws2,
+                                 ComparisonResult showdown, bool verbose) {
+    // 双方都不弃牌时按比牌结果结算，stake 是每人投入的注数
+    auto settle = [showdown](int stake) {
+        RoundOutcome outcome;
+        outcome.result = showdown;
+        outcome.player1_units = showdown == ComparisonResult::Hand1Wins ? stake
+                              : showdown == ComparisonResult::Hand2Wins ? -stake
+                                                                        : 0;
+        return outcome;
+    };
+    // 弃牌的一方输掉自己的底注
+    auto fold = [](ComparisonResult winner) {
+        RoundOutcome outcome;
+        outcome.result = winner;
+        outcome.folded = true;
+        outcome.player1_units = winner == ComparisonResult::Hand1Wins ? ANTE : -ANTE;
+        return outcome;
+    };
+    auto act = [verbose](Player& player, BetHistory history, size_t opponentDraws) {
+        const bool aggressive = player.decide_bet(history, opponentDraws);
+        if (verbose) {
+            const bool facingBet = history == BetHistory::Bet || history == BetHistory::CheckBet;
+            std::cout << player.get_name()
+                      << (facingBet ? (aggressive ? " 跟注" : " 弃牌") : (aggressive ? " 下注" : " 过牌")) << ".\n";
+        }
+        return aggressive;
+    };
+
+    if (act(player1, BetHistory::Root, draws2)) {
+        return act(player2, BetHistory::Bet, draws1) ? settle(ANTE + BET_SIZE) : fold(ComparisonResult::Hand1Wins);
+    }
+    if (!act(player2, BetHistory::Checked, draws1)) {
+        return settle(ANTE);
+    }
+    return act(player1, BetHistory::CheckBet, draws2) ? settle(ANTE + BET_SIZE) : fold(ComparisonResult::Hand2Wins);
+}
 
-    for (size_t index : aiCardsToReplace) {
-        ai_player_->get_hand().remove_card(index);
+RoundOutcome Game::play_headless_round(Deck& deck, Player& player1, Player& player2,
+                                       HandHistoryRecord* record) {
+    deal_cards(deck, player1, player2);
+    if (record) {
+        store_cards(player1.get_hand(), record->dealt[0]);
+        store_cards(player2.get_hand(), record->dealt[1]);
     }
 
-    for (size_t i = 0; i < aiCardsToReplace.size(); ++i) {
-        if (auto card = deck_.deal_card()) {
-            ai_player_->get_hand().add_card(*card);
+    // 与交互模式相同：庄家（玩家2）先换牌
+    const DiscardMask discards2 = player2.decide_discards();
+    const size_t draws2 = replace_cards(deck, player2, discards2);
+    const DiscardMask discards1 = player1.decide_discards();
+    const size_t draws1 = replace_cards(deck, player1, discards1);
+
+    const HandScore score1 = HandEvaluator::evaluate_score(player1.get_hand());
+    const HandScore score2 = HandEvaluator::evaluate_score(player2.get_hand());
+    const RoundOutcome outcome =
+        betting_round(player1, player2, draws1, draws2, HandComparator::compare_scores(score1, score2));
+
+    if (record) {
+        record->discards = {discards1, discards2};
+        store_cards(player1.get_hand(), record->final_hands[0]);
+        store_cards(player2.get_hand(), record->final_hands[1]);
+        record->scores = {score1, score2};
+        switch (outcome.result) {
+            case ComparisonResult::Hand1Wins: record->winner = 1; break;
+            case ComparisonResult::Hand2Wins: record->winner = 2; break;
+            case ComparisonResult::Tie:       record->winner = 0; break;
         }
     }
+    return outcome;
+}
 
-    std::cout << "庄家换了 " << aiCardsToReplace.size() << " 张牌.\n\n";
+void Game::deal_cards() {
+    std::cout << "发牌...\n\n";
+    deal_cards(deck_, *human_player_, *ai_player_);
+}
+
+std::array<size_t, 2> Game::replace_cards_phase() {
+    print_separator();
+    std::cout << "换牌阶段\n";
+    print_separator();
+
+    // AI玩家换牌（不显示过程）
+    const size_t aiReplaced = replace_cards(deck_, *ai_player_, ai_player_->decide_discards());
+    std::cout << ai_player_->get_name() << "换了 " << aiReplaced << " 张牌.\n\n";
 
     // 人类玩家换牌
     human_player_->show_hand();
@@ -63,32 +185,44 @@ void Game::replace_cards_phase() {
     HandEvaluation eval = HandEvaluator::evaluate(human_player_->get_hand());
     std::cout << "你的手牌: " << eval.to_string() << "\n\n";
 
-    auto humanCardsToReplace = human_player_->decide_cards_to_replace();
+    const DiscardMask humanDiscards = human_player_->decide_discards();
+    size_t humanReplaced = 0;
 
-    if (humanCardsToReplace.empty()) {
+    if (humanDiscards == 0) {
         std::cout << "你选择不换牌.\n";
     } else {
-        std::cout << "换 " << humanCardsToReplace.size() << " 张牌...\n";
-
-        // 按降序排序以避免索引问题
-        std::sort(humanCardsToReplace.begin(), humanCardsToReplace.end(), std::greater<size_t>());
+        std::cout << "换 " << std::popcount(humanDiscards) << " 张牌...\n";
 
-        for (size_t index : humanCardsToReplace) {
-            human_player_->get_hand().remove_card(index);
-        }
-
-        for (size_t i = 0; i < humanCardsToReplace.size(); ++i) {
-            if (auto card = deck_.deal_card()) {
-                human_player_->get_hand().add_card(*card);
-            }
-        }
+        humanReplaced = replace_cards(deck_, *human_player_, humanDiscards);
 
         std::cout << "\n你的新手牌:\n";
         human_player_->show_hand();
     }
+    return {humanReplaced, aiReplaced};
 }
 
-void Game::showdown() {
+RoundOutcome Game::betting_phase(const std::array<size_t, 2>& draws) {
+    print_separator();
+    std::cout << "下注阶段（底注 " << ANTE << "，下注额 " << BET_SIZE << "）\n";
+    print_separator();
+
+    const ComparisonResult result = HandComparator::compare(human_player_->get_hand(), ai_player_->get_hand());
+    return betting_round(*human_player_, *ai_player_, draws[0], draws[1], result, true);
+}
+
+void Game::showdown(const RoundOutcome& outcome) {
+    statistics_.record(outcome);
+
+    if (outcome.folded) {
+        print_separator();
+        std::cout << "结果: " << (outcome.result == ComparisonResult::Hand1Wins ? human_player_->get_name()
+                                                                                : ai_player_->get_name())
+                  << " 胜（对手弃牌）!\n";
+        std::cout << human_player_->get_name() << "本局输赢: " << outcome.player1_units << "\n";
+        print_separator();
+        return;
+    }
+
     print_separator();
     std::cout << "SHOWDOWN\n";
     print_separator();
@@ -103,32 +237,29 @@ void Game::showdown() {
     HandEvaluation aiEval = HandEvaluator::evaluate(ai_player_->get_hand());
     std::cout << "Hand: " << aiEval.to_string() << "\n\n";
 
-    // 比较结果
-    ComparisonResult result = HandComparator::compare(
-        human_player_->get_hand(),
-        ai_player_->get_hand()
-    );
-
     print_separator();
     std::cout << "结果: ";
-    switch (result) {
+    switch (outcome.result) {
         case ComparisonResult::Hand1Wins:
             std::cout << human_player_->get_name() << " 胜!\n";
-            human_wins_++;
             break;
         case ComparisonResult::Hand2Wins:
             std::cout << ai_player_->get_name() << " 胜!\n";
-            ai_wins_++;
             break;
         case ComparisonResult::Tie:
             std::cout << "平局!\n";
-            ties_++;
             break;
     }
+    std::cout << human_player_->get_name() << "本局输赢: " << outcome.player1_units << "\n";
     print_separator();
 }
 
 void Game::play_round() {
+    if (mode_ == GameMode::Headless) {
+        statistics_.record(play_headless_round(deck_, *human_player_, *ai_player_));
+        return;
+    }
+
     deal_cards();
 
     human_player_->show_hand();
@@ -136,11 +267,16 @@ void Game::play_round() {
     HandEvaluation eval = HandEvaluator::evaluate(human_player_->get_hand());
     std::cout << "当前手牌: " << eval.to_string() << "\n";
 
-    replace_cards_phase();
-    showdown();
+    const std::array<size_t, 2> draws = replace_cards_phase();
+    showdown(betting_phase(draws));
 }
 
 void Game::play_multiple_rounds(int numRounds) {
+    if (mode_ == GameMode::Headless) {
+        simulate(static_cast<std::uint64_t>(std::max(numRounds, 0)));
+        return;
+    }
+
     for (int i = 0; i < numRounds; ++i) {
         std::cout << "\n\n";
         print_separator();
@@ -160,19 +296,98 @@ void Game::play_multiple_rounds(int numRounds) {
     show_statistics();
 }
 
+SimulationReport Game::simulate(std::uint64_t rounds, size_t threads, std::uint64_t seed,
+                                HandHistoryWriter* history) {
+    if (human_player_->is_interactive() || ai_player_->is_interactive()) {
+        throw std::invalid_argument("无界面模拟不能使用需要交互的玩家");
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (seed == 0) {
+        seed = (std::uint64_t{std::random_device{}()} << 32) | std::random_device{}();
+    }
+
+    // 每个线程一份统计，独占缓存行，结束时合并
+    struct alignas(64) ThreadStatistics {
+        GameStatistics statistics;
+    };
+    std::vector<ThreadStatistics> partials(threads);
+
+    auto worker = [&](size_t index, std::uint64_t threadSeed) {
+        const std::uint64_t begin = rounds * index / threads;
+        const std::uint64_t end = rounds * (index + 1) / threads;
+
+        Deck deck(threadSeed);
+        const auto player1 = human_player_->clone();
+        const auto player2 = ai_player_->clone();
+        GameStatistics local;
+        if (history == nullptr) {
+            for (std::uint64_t i = begin; i < end; ++i) {
+                local.record(play_headless_round(deck, *player1, *player2));
+            }
+        } else {
+            std::vector<HandHistoryRecord> batch(HISTORY_BATCH);
+            size_t pending = 0;
+            for (std::uint64_t i = begin; i < end; ++i) {
+                local.record(play_headless_round(deck, *player1, *player2, &batch[pending]));
+                if (++pending == HISTORY_BATCH) {
+                    history->append(batch);
+                    pending = 0;
+                }
+            }
+            history->append(std::span(batch).first(pending));
+        }
+        partials[index].statistics = local;
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+
+    SplitMix64 seeds(seed);
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (size_t i = 1; i < threads; ++i) {
+        pool.emplace_back(worker, i, seeds());
+    }
+    worker(0, seeds());  // 调用线程也参与模拟
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    if (history != nullptr) {
+        history->flush();
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    SimulationReport report;
+    for (const auto& partial : partials) {
+        report.statistics += partial.statistics;
+    }
+    report.threads = threads;
+    report.seconds = elapsed.count();
+    report.rounds_per_second = elapsed.count() > 0.0
+        ? static_cast<double>(report.statistics.total()) / elapsed.count()
+        : 0.0;
+
+    statistics_ += report.statistics;
+    return report;
+}
+
 void Game::show_statistics() const {
     print_separator();
     std::cout << "游戏统计\n";
     print_separator();
-    std::cout << human_player_->get_name() << " 获胜: " << human_wins_ << "\n";
-    std::cout << ai_player_->get_name() << " 获胜: " << ai_wins_ << "\n";
-    std::cout << "平局: " << ties_ << "\n";
+    std::cout << human_player_->get_name() << " 获胜: " << statistics_.human_wins << "\n";
+    std::cout << ai_player_->get_name() << " 获胜: " << statistics_.ai_wins << "\n";
+    std::cout << "平局: " << statistics_.ties << "\n";
     print_separator();
 
-    int totalGames = human_wins_ + ai_wins_ + ties_;
+    const std::uint64_t totalGames = statistics_.total();
     if (totalGames > 0) {
         std::cout << "胜率: "
-                  << (human_wins_ * 100.0 / totalGames) << "%\n";
+                  << (static_cast<double>(statistics_.human_wins) * 100.0 / static_cast<double>(totalGames)) << "%\n";
+        std::cout << human_player_->get_name() << " 净输赢: " << statistics_.human_units << "（每局 "
+                  << (static_cast<double>(statistics_.human_units) / static_cast<double>(totalGames)) << "）\n";
         print_separator();
     }
 }
@@ -4,35 +4,44 @@
 
 namespace Poker {
 
-Hand::Hand(const std::vector<Card>& cards) : cards_(cards) {}
+Hand::Hand(const std::vector<Card>& cards) {
+    for (const auto& card : cards) {
+        add_card(card);
+    }
+}
 
 void Hand::add_card(const Card& card) {
     if (!is_full()) {
-        cards_.push_back(card);
+        cards_[size_++] = card;
+        state_.add_card(PackedCard(card));
     }
 }
 
 void Hand::replace_card(size_t index, const Card& card) {
-    if (index < cards_.size()) {
+    if (index < size_) {
+        state_.replace_card(PackedCard(cards_[index]), PackedCard(card));
         cards_[index] = card;
     }
 }
 
 void Hand::remove_card(const size_t index) {
-    if (index < cards_.size()) {
-        cards_.erase(cards_.begin() + index);
+    if (index < size_) {
+        state_.remove_card(PackedCard(cards_[index]));
+        std::move(cards_.begin() + index + 1, cards_.begin() + size_, cards_.begin() + index);
+        --size_;
     }
 }
 
 void Hand::clear() {
-    cards_.clear();
+    size_ = 0;
+    state_.clear();
 }
 
 std::string Hand::to_string() const {
     std::ostringstream oss;
-    for (size_t i = 0; i < cards_.size(); ++i) {
+    for (size_t i = 0; i < size_; ++i) {
         oss << cards_[i].to_string();
-        if (i < cards_.size() - 1) {
+        if (i + 1 < size_) {
             oss << "\n";
         }
     }
@@ -40,7 +49,7 @@ std::string Hand::to_string() const {
 }
 
 void Hand::sort_by_rank() {
-    std::sort(cards_.begin(), cards_.end(), [](const Card& a, const Card& b) {
+    std::sort(cards_.begin(), cards_.begin() + size_, [](const Card& a, const Card& b) {
         return a.get_rank() < b.get_rank();
     });
 }
@@ -1,5 +1,8 @@
 #include "HandEvaluator.h"
+#include "EvaluatorTables.h"
+#include "SevenCardTables.h"
 #include <algorithm>
+#include <bit>
 #include <set>
 
 namespace Poker {
@@ -228,4 +231,93 @@ HandEvaluation HandEvaluator::evaluate(const Hand& hand) {
     return HandEvaluation(HandRank::HighCard, kickers);
 }
 
+HandStrength HandEvaluator::evaluate_strength(const Hand& hand) {
+    return evaluate_strength(hand.state());
+}
+
+HandStrength HandEvaluator::evaluate_strength(const PackedHand& hand) {
+    if (!hand.is_full()) {
+        return 0;
+    }
+
+    // 紧凑编码下只需位运算：花色位相与、点数位相或、质数相乘
+    const auto cards = hand.get_cards();
+    const std::uint32_t c0 = cards[0].bits(), c1 = cards[1].bits(), c2 = cards[2].bits(),
+                        c3 = cards[3].bits(), c4 = cards[4].bits();
+    const std::uint32_t rankMask = (c0 | c1 | c2 | c3 | c4) >> 16;
+
+    const auto& tables = EvaluatorTables::instance();
+    if ((c0 & c1 & c2 & c3 & c4 & 0xF000) != 0) {
+        return tables.flush(rankMask);
+    }
+    if (std::popcount(rankMask) == static_cast<int>(Hand::HAND_SIZE)) {
+        return tables.unique5(rankMask);
+    }
+    return tables.paired(cards[0].prime() * cards[1].prime() * cards[2].prime() *
+                         cards[3].prime() * cards[4].prime());
+}
+
+HandStrength HandEvaluator::evaluate_strength(const HandState& state) {
+    if (state.size() != Hand::HAND_SIZE) {
+        return 0;
+    }
+
+    // 增量状态中已经有查表需要的全部值
+    const auto& tables = EvaluatorTables::instance();
+    if (state.is_flush()) {
+        return tables.flush(state.rank_mask());
+    }
+    if (std::popcount(state.rank_mask()) == static_cast<int>(Hand::HAND_SIZE)) {
+        return tables.unique5(state.rank_mask());
+    }
+    return tables.paired(state.prime_product());
+}
+
+HandStrength HandEvaluator::evaluate_strength7(std::uint64_t cardMask) {
+    if (std::popcount(cardMask) != static_cast<int>(SevenCardTables::HAND_SIZE)) {
+        return 0;
+    }
+    return SevenCardTables::instance().evaluate(cardMask);
+}
+
+HandStrength HandEvaluator::evaluate_strength7(std::span<const PackedCard> cards) {
+    std::uint64_t mask = 0;
+    for (const auto& card : cards) {
+        mask |= card.mask_bit();
+    }
+    // 有重复的牌时掩码少于7位
+    return cards.size() == SevenCardTables::HAND_SIZE ? evaluate_strength7(mask) : 0;
+}
+
+HandRank HandEvaluator::strength_to_rank(HandStrength strength) {
+    return EvaluatorTables::instance().category(strength);
+}
+
+HandScore HandEvaluator::evaluate_score(const Hand& hand) {
+    return evaluate_score(hand.state());
+}
+
+HandScore HandEvaluator::evaluate_score(const PackedHand& hand) {
+    const HandStrength strength = evaluate_strength(hand);
+    if (strength == 0) {
+        return 0;
+    }
+
+    // 牌力相同时比较第一个 kicker 点数的最大花色：直接编码到最低两位
+    const Rank lead = EvaluatorTables::instance().lead_rank(strength);
+    const auto suit = static_cast<unsigned>(*hand.highest_suit_of(lead));
+    return static_cast<HandScore>(strength << SCORE_SUIT_BITS | suit);
+}
+
+HandScore HandEvaluator::evaluate_score(const HandState& state) {
+    const HandStrength strength = evaluate_strength(state);
+    if (strength == 0) {
+        return 0;
+    }
+
+    const Rank lead = EvaluatorTables::instance().lead_rank(strength);
+    const auto suit = static_cast<unsigned>(*state.highest_suit_of(lead));
+    return static_cast<HandScore>(strength << SCORE_SUIT_BITS | suit);
+}
+
 } // namespace Poker
@@ -0,0 +1,138 @@
+#include "HandEvaluator.h"
+#include "EvaluatorTables.h"
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define POKER_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+namespace Poker {
+
+namespace {
+
+using BatchKernel = void (*)(std::span<const PackedHand>, std::span<HandStrength>);
+
+// gather 按32位字寻址：一张牌一个字，一手牌整数个字
+static_assert(sizeof(PackedCard) == sizeof(std::uint32_t));
+static_assert(sizeof(PackedHand) % sizeof(std::uint32_t) == 0);
+
+void evaluate_batch_scalar(std::span<const PackedHand> hands, std::span<HandStrength> strengths) {
+    for (size_t i = 0; i < hands.size(); ++i) {
+        strengths[i] = HandEvaluator::evaluate_strength(hands[i]);
+    }
+}
+
+#ifdef POKER_X86_DISPATCH
+
+// 向量版 EvaluatorTables::mix
+__attribute__((target("avx2"))) inline __m256i mix8(__m256i x) {
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+    x = _mm256_mullo_epi32(x, _mm256_set1_epi32(0x7feb352d));
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 15));
+    x = _mm256_mullo_epi32(x, _mm256_set1_epi32(static_cast<int>(0x846ca68bU)));
+    return _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+}
+
+// 从16位表中按下标取8个表项（32位 gather 后去掉高16位，表末尾有 GATHER_PADDING）
+__attribute__((target("avx2"))) inline __m256i lookup8(const std::uint16_t* table, __m256i index) {
+    const __m256i words = _mm256_i32gather_epi32(reinterpret_cast<const int*>(table), index, 2);
+    return _mm256_and_si256(words, _mm256_set1_epi32(0xFFFF));
+}
+
+// 每次迭代评估8手牌，与 evaluate_strength(const PackedHand&) 的三种情况一一对应：
+// - 5张牌的花色位相与不为0：查 flush 表
+// - unique5 表非0（点数掩码恰好5位）：取 unique5 表
+// - 否则：质数之积经完美哈希查 paired 表
+// 三种结果都算出来后按掩码选择，没有分支
+__attribute__((target("avx2")))
+void evaluate_batch_avx2(std::span<const PackedHand> hands, std::span<HandStrength> strengths) {
+    const auto& tables = EvaluatorTables::instance();
+
+    // 相邻两手牌的牌在内存中相隔 sizeof(PackedHand) 字节
+    constexpr int STRIDE = static_cast<int>(sizeof(PackedHand) / sizeof(std::uint32_t));
+    const __m256i handOffsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                                   _mm256_set1_epi32(STRIDE));
+    const __m256i primeMask = _mm256_set1_epi32(0x3F);
+    const __m256i slotMask = _mm256_set1_epi32(static_cast<int>(EvaluatorTables::PAIRED_SLOTS - 1));
+
+    size_t i = 0;
+    for (; i + 8 <= hands.size(); i += 8) {
+        const auto* base = reinterpret_cast<const int*>(hands[i].get_cards().data());
+        __m256i cards[PackedHand::CAPACITY];
+        for (size_t c = 0; c < PackedHand::CAPACITY; ++c) {
+            cards[c] = _mm256_i32gather_epi32(base + c, handOffsets, 4);
+        }
+
+        __m256i rankBits = cards[0];
+        __m256i suitBits = cards[0];
+        __m256i product = _mm256_and_si256(cards[0], primeMask);
+        for (size_t c = 1; c < PackedHand::CAPACITY; ++c) {
+            rankBits = _mm256_or_si256(rankBits, cards[c]);
+            suitBits = _mm256_and_si256(suitBits, cards[c]);
+            product = _mm256_mullo_epi32(product, _mm256_and_si256(cards[c], primeMask));
+        }
+        const __m256i rankMask = _mm256_srli_epi32(rankBits, 16);
+        const __m256i notFlush = _mm256_cmpeq_epi32(_mm256_and_si256(suitBits, _mm256_set1_epi32(0xF000)),
+                                                    _mm256_setzero_si256());
+
+        const __m256i flush = lookup8(tables.flush_data(), rankMask);
+        const __m256i unique = lookup8(tables.unique5_data(), rankMask);
+
+        const __m256i h = mix8(product);
+        const __m256i bucket = _mm256_srli_epi32(h, 32 - EvaluatorTables::PAIRED_BUCKET_BITS);
+        const __m256i displace = lookup8(tables.displace_data(), bucket);
+        const __m256i slot = _mm256_and_si256(mix8(_mm256_xor_si256(h, displace)), slotMask);
+        const __m256i paired = lookup8(tables.paired_data(), slot);
+
+        const __m256i isUnique = _mm256_xor_si256(_mm256_cmpeq_epi32(unique, _mm256_setzero_si256()),
+                                                  _mm256_set1_epi32(-1));
+        const __m256i nonFlush = _mm256_blendv_epi8(paired, unique, isUnique);
+        __m256i result = _mm256_blendv_epi8(flush, nonFlush, notFlush);
+
+        // 不满5张的手牌为0（很少见，逐手检查即可）
+        for (size_t k = 0; k < 8; ++k) {
+            if (!hands[i + k].is_full()) {
+                alignas(32) std::uint32_t lanes[8];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), result);
+                for (size_t j = 0; j < 8; ++j) {
+                    if (!hands[i + j].is_full()) {
+                        lanes[j] = 0;
+                    }
+                }
+                result = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes));
+                break;
+            }
+        }
+
+        // 8个32位结果压缩成8个16位
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(strengths.data() + i), _mm256_castsi256_si128(packed));
+    }
+
+    evaluate_batch_scalar(hands.subspan(i), strengths.subspan(i));
+}
+
+#endif
+
+BatchKernel select_kernel() {
+#ifdef POKER_X86_DISPATCH
+    if (__builtin_cpu_supports("avx2")) {
+        return evaluate_batch_avx2;
+    }
+#endif
+    return evaluate_batch_scalar;
+}
+
+} // namespace
+
+void HandEvaluator::evaluate_batch(std::span<const PackedHand> hands, std::span<HandStrength> strengths) {
+    if (strengths.size() < hands.size()) {
+        throw std::invalid_argument("结果数组长度不足");
+    }
+
+    static const BatchKernel kernel = select_kernel();
+    kernel(hands, strengths);
+}
+
+} // namespace Poker
@@ -0,0 +1,346 @@
+#include "HandHistory.h"
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace Poker {
+
+namespace Format = HandHistoryFormat;
+
+namespace {
+
+constexpr size_t CARD_COLUMN = Format::BLOCK_ROUNDS * Format::CARDS;
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t blockRounds;
+};
+static_assert(sizeof(FileHeader) == Format::FILE_HEADER_BYTES);
+
+struct BlockHeader {
+    std::uint32_t count;
+    std::uint32_t reserved;
+    std::uint64_t firstRound;
+};
+static_assert(sizeof(BlockHeader) == Format::BLOCK_HEADER_BYTES);
+
+[[noreturn]] void throw_errno(const std::string& what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+// 写出全部 iovec，处理部分写入
+void write_all(int fd, iovec* iov, int count) {
+    while (count > 0) {
+        const ssize_t written = ::writev(fd, iov, count);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_errno("写入牌局记录失败");
+        }
+        size_t remaining = static_cast<size_t>(written);
+        while (count > 0 && remaining >= iov->iov_len) {
+            remaining -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+        if (count > 0) {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + remaining;
+            iov->iov_len -= remaining;
+        }
+    }
+}
+
+} // namespace
+
+// 内存中的块：各列是独立的数组，写出时由 writev 按文件中的顺序拼接
+struct HandHistoryWriter::Block {
+    BlockHeader header{};
+    std::array<std::array<HandScore, Format::BLOCK_ROUNDS>, Format::PLAYERS> scores{};
+    std::array<std::array<std::uint8_t, CARD_COLUMN>, Format::PLAYERS> dealt{};
+    std::array<std::array<std::uint8_t, CARD_COLUMN>, Format::PLAYERS> finalHands{};
+    std::array<std::array<DiscardMask, Format::BLOCK_ROUNDS>, Format::PLAYERS> discards{};
+    std::array<std::uint8_t, Format::BLOCK_ROUNDS> winners{};
+
+    [[nodiscard]] bool full() const noexcept { return header.count == Format::BLOCK_ROUNDS; }
+
+    void add(const HandHistoryRecord& record) noexcept {
+        const size_t n = header.count++;
+        for (size_t p = 0; p < Format::PLAYERS; ++p) {
+            scores[p][n] = record.scores[p];
+            std::memcpy(&dealt[p][n * Format::CARDS], record.dealt[p].data(), Format::CARDS);
+            std::memcpy(&finalHands[p][n * Format::CARDS], record.final_hands[p].data(), Format::CARDS);
+            discards[p][n] = record.discards[p];
+        }
+        winners[n] = record.winner;
+    }
+};
+
+HandHistoryWriter::HandHistoryWriter(const std::string& path) {
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throw_errno("无法创建牌局记录文件 " + path);
+    }
+
+    const FileHeader header{Format::MAGIC, 1, static_cast<std::uint32_t>(Format::BLOCK_ROUNDS)};
+    iovec iov{const_cast<FileHeader*>(&header), sizeof(header)};
+    try {
+        write_all(fd_, &iov, 1);
+    } catch (...) {
+        ::close(fd_);
+        throw;
+    }
+
+    blocks_[0] = std::make_unique<Block>();
+    blocks_[1] = std::make_unique<Block>();
+    thread_ = std::thread(&HandHistoryWriter::write_loop, this);
+}
+
+HandHistoryWriter::~HandHistoryWriter() {
+    try {
+        flush();
+    } catch (...) {
+        // 析构时无法报告错误，调用方需要错误信息时应先显式调用 flush()
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    thread_.join();
+    ::close(fd_);
+}
+
+void HandHistoryWriter::append(const HandHistoryRecord& record) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    append_locked(record, lock);
+}
+
+void HandHistoryWriter::append(std::span<const HandHistoryRecord> records) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (const auto& record : records) {
+        append_locked(record, lock);
+    }
+}
+
+void HandHistoryWriter::append_locked(const HandHistoryRecord& record, std::unique_lock<std::mutex>& lock) {
+    // 提交满块时会释放锁等待，其他线程可能在这期间进来，看到的仍是满块
+    while (blocks_[active_]->full()) {
+        submit_locked(lock);
+    }
+    blocks_[active_]->add(record);
+    ++rounds_;
+    if (blocks_[active_]->full()) {
+        submit_locked(lock);
+    }
+}
+
+void HandHistoryWriter::submit_locked(std::unique_lock<std::mutex>& lock) {
+    // 另一块还没写完时等待（写盘跟不上时才会发生）
+    const Block* submitting = blocks_[active_].get();
+    wait_written_locked(lock);
+    if (blocks_[active_].get() != submitting) {
+        return;  // 等待期间其他线程已经提交了这一块
+    }
+
+    Block& block = *blocks_[active_];
+    block.header.firstRound = rounds_ - block.header.count;
+    writing_ = &block;
+    active_ ^= 1;
+    blocks_[active_]->header.count = 0;
+    cv_.notify_all();
+}
+
+void HandHistoryWriter::wait_written_locked(std::unique_lock<std::mutex>& lock) {
+    cv_.wait(lock, [this] { return writing_ == nullptr; });
+    if (error_) {
+        std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+}
+
+void HandHistoryWriter::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (blocks_[active_]->header.count > 0) {
+        submit_locked(lock);
+    }
+    wait_written_locked(lock);
+}
+
+std::uint64_t HandHistoryWriter::rounds() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return rounds_;
+}
+
+void HandHistoryWriter::write_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        cv_.wait(lock, [this] { return stopping_ || writing_ != nullptr; });
+        if (writing_ == nullptr) {
+            return;  // stopping_ 且没有待写的块
+        }
+
+        const Block* block = writing_;
+        lock.unlock();
+        std::exception_ptr error;
+        try {
+            write_block(*block);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        lock.lock();
+
+        if (error && !error_) {
+            error_ = error;
+        }
+        writing_ = nullptr;
+        cv_.notify_all();
+    }
+}
+
+void HandHistoryWriter::write_block(const Block& block) {
+    // 整块定长写出（未满时多出的部分内容无意义），读取时可按块号直接定位
+    std::array<iovec, 10> iov{};
+    size_t n = 0;
+    auto add = [&](const void* data, size_t bytes) {
+        iov[n++] = {const_cast<void*>(data), bytes};
+    };
+    add(&block.header, sizeof(block.header));
+    for (const auto& column : block.scores) add(column.data(), sizeof(column));
+    for (const auto& column : block.dealt) add(column.data(), sizeof(column));
+    for (const auto& column : block.finalHands) add(column.data(), sizeof(column));
+    for (const auto& column : block.discards) add(column.data(), sizeof(column));
+    add(block.winners.data(), sizeof(block.winners));
+
+    write_all(fd_, iov.data(), static_cast<int>(n));
+}
+
+HandHistoryReader::HandHistoryReader(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw_errno("无法打开牌局记录文件 " + path);
+    }
+
+    struct stat info {};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw_errno("无法读取牌局记录文件 " + path);
+    }
+    bytes_ = static_cast<size_t>(info.st_size);
+
+    if (bytes_ < Format::FILE_HEADER_BYTES ||
+        (bytes_ - Format::FILE_HEADER_BYTES) % Format::BLOCK_BYTES != 0) {
+        ::close(fd);
+        throw std::runtime_error("牌局记录文件格式错误: " + path);
+    }
+
+    void* mapped = ::mmap(nullptr, bytes_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // 映射建立后不再需要文件描述符
+    if (mapped == MAP_FAILED) {
+        throw_errno("无法映射牌局记录文件 " + path);
+    }
+    data_ = static_cast<const std::byte*>(mapped);
+
+    // 按列顺序扫描，提示内核预读
+    ::madvise(mapped, bytes_, MADV_SEQUENTIAL);
+
+    FileHeader header{};
+    std::memcpy(&header, data_, sizeof(header));
+    if (header.magic != Format::MAGIC || header.version != 1 || header.blockRounds != Format::BLOCK_ROUNDS) {
+        ::munmap(mapped, bytes_);
+        throw std::runtime_error("牌局记录文件格式错误: " + path);
+    }
+
+    // 每块至少一局，且各块的序号首尾相接
+    blocks_ = (bytes_ - Format::FILE_HEADER_BYTES) / Format::BLOCK_BYTES;
+    firstRounds_.reserve(blocks_);
+    for (size_t b = 0; b < blocks_; ++b) {
+        BlockHeader blockHeader{};
+        std::memcpy(&blockHeader, data_ + Format::FILE_HEADER_BYTES + b * Format::BLOCK_BYTES, sizeof(blockHeader));
+        if (blockHeader.count == 0 || blockHeader.count > Format::BLOCK_ROUNDS || blockHeader.firstRound != rounds_) {
+            ::munmap(mapped, bytes_);
+            throw std::runtime_error("牌局记录文件的块头错误: " + path);
+        }
+        firstRounds_.push_back(blockHeader.firstRound);
+        rounds_ += blockHeader.count;
+    }
+}
+
+HandHistoryReader::~HandHistoryReader() {
+    ::munmap(const_cast<std::byte*>(data_), bytes_);
+}
+
+HandHistoryBlock HandHistoryReader::block(size_t index) const {
+    const std::byte* base = data_ + Format::FILE_HEADER_BYTES + index * Format::BLOCK_BYTES;
+
+    BlockHeader header{};
+    std::memcpy(&header, base, sizeof(header));
+
+    // 块大小是偶数，文件映射按页对齐，分值列按2字节对齐
+    const auto bytes = [base](size_t offset) { return reinterpret_cast<const std::uint8_t*>(base + offset); };
+    const size_t count = std::min<size_t>(header.count, Format::BLOCK_ROUNDS);
+
+    HandHistoryBlock view;
+    view.first_round = header.firstRound;
+    view.count = count;
+    for (size_t p = 0; p < Format::PLAYERS; ++p) {
+        view.scores[p] = {reinterpret_cast<const HandScore*>(base + Format::scores_offset(p)), count};
+        view.dealt[p] = {bytes(Format::dealt_offset(p)), count * Format::CARDS};
+        view.final_hands[p] = {bytes(Format::final_offset(p)), count * Format::CARDS};
+        view.discards[p] = {bytes(Format::discards_offset(p)), count};
+    }
+    view.winners = {bytes(Format::WINNER_OFFSET), count};
+    return view;
+}
+
+HandHistoryRecord HandHistoryReader::record(std::uint64_t round) const {
+    if (round >= rounds_) {
+        throw std::out_of_range("牌局序号超出范围");
+    }
+    // flush() 可能在文件中间留下不满的块，不能按 BLOCK_ROUNDS 换算块号
+    const auto next = std::upper_bound(firstRounds_.begin(), firstRounds_.end(), round);
+    const HandHistoryBlock view = block(static_cast<size_t>(next - firstRounds_.begin()) - 1);
+    const size_t i = static_cast<size_t>(round - view.first_round);
+    if (i >= view.count) {
+        throw std::out_of_range("牌局序号超出范围");
+    }
+
+    HandHistoryRecord record;
+    for (size_t p = 0; p < Format::PLAYERS; ++p) {
+        std::copy_n(view.dealt[p].begin() + i * Format::CARDS, Format::CARDS, record.dealt[p].begin());
+        std::copy_n(view.final_hands[p].begin() + i * Format::CARDS, Format::CARDS, record.final_hands[p].begin());
+        record.discards[p] = view.discards[p][i];
+        record.scores[p] = view.scores[p][i];
+    }
+    record.winner = view.winners[i];
+    return record;
+}
+
+std::vector<std::uint64_t> HandHistoryReader::find_rounds(size_t player, int drawn, bool won) const {
+    if (player >= Format::PLAYERS) {
+        throw std::out_of_range("玩家下标超出范围");
+    }
+    const auto winner = static_cast<std::uint8_t>(player + 1);
+
+    std::vector<std::uint64_t> rounds;
+    scan([&](const HandHistoryBlock& view) {
+        for (size_t i = 0; i < view.count; ++i) {
+            if (std::popcount(view.discards[player][i]) == drawn && (view.winners[i] == winner) == won) {
+                rounds.push_back(view.first_round + i);
+            }
+        }
+    });
+    return rounds;
+}
+
+} // namespace Poker
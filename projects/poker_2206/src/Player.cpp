@@ -1,6 +1,9 @@
 #include "Player.h"
+#include "DrawOptimizer.h"
+#include <array>
+#include <bit>
 #include <iostream>
-#include <map>
+#include <optional>
 #include <algorithm>
 #include <sstream>
 
@@ -22,10 +25,25 @@ void Player::show_hand(bool hideCards) const {
     }
 }
 
+std::vector<size_t> Player::decide_cards_to_replace() {
+    const DiscardMask discards = decide_discards();
+    std::vector<size_t> cardsToReplace;
+    for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+        if (discards & (1U << i)) {
+            cardsToReplace.push_back(i);
+        }
+    }
+    return cardsToReplace;
+}
+
+bool Player::decide_bet(BetHistory history, size_t /*opponentDraws*/) {
+    return history == BetHistory::Bet || history == BetHistory::CheckBet;
+}
+
 HumanPlayer::HumanPlayer(const std::string& name) : Player(name) {}
 
-std::vector<size_t> HumanPlayer::decide_cards_to_replace() {
-    std::vector<size_t> cardsToReplace;
+DiscardMask HumanPlayer::decide_discards() {
+    DiscardMask discards = 0;
     std::cout << "\n输入你想换的牌 (1-5), 空格隔开.\n";
     std::cout << "如果你觉得这手牌不错，直接按回车跳过换牌: ";
 
@@ -33,128 +51,119 @@ std::vector<size_t> HumanPlayer::decide_cards_to_replace() {
     std::getline(std::cin, line);
 
     if (line.empty()) {
-        return cardsToReplace;
+        return discards;
     }
 
+    // 重复输入的位置只算一次
     std::istringstream iss(line);
     int cardNum;
     while (iss >> cardNum) {
         if (cardNum >= 1 && cardNum <= static_cast<int>(hand_.size())) {
-            cardsToReplace.push_back(cardNum - 1);
+            discards |= static_cast<DiscardMask>(1U << (cardNum - 1));
         }
     }
 
-    // 移除重复的索引并排序
-    std::sort(cardsToReplace.begin(), cardsToReplace.end());
-    cardsToReplace.erase(
-        std::unique(cardsToReplace.begin(), cardsToReplace.end()),
-        cardsToReplace.end()
-    );
+    return discards;
+}
 
-    return cardsToReplace;
+bool HumanPlayer::decide_bet(BetHistory history, size_t /*opponentDraws*/) {
+    const bool facingBet = history == BetHistory::Bet || history == BetHistory::CheckBet;
+    if (facingBet) {
+        std::cout << "\n对手下注. 跟注输入 c，直接按回车弃牌: ";
+    } else {
+        std::cout << "\n下注输入 b，直接按回车过牌: ";
+    }
+
+    std::string line;
+    std::getline(std::cin, line);
+    return !line.empty() && (line[0] == (facingBet ? 'c' : 'b') || line[0] == (facingBet ? 'C' : 'B'));
 }
 
-AIPlayer::AIPlayer(const std::string& name) : Player(name) {}
+std::unique_ptr<Player> HumanPlayer::clone() const {
+    return std::make_unique<HumanPlayer>(name_);
+}
 
-bool AIPlayer::is_almost_flush() const {
-    std::map<Suit, int> suitCounts;
-    for (const auto& card : hand_.get_cards()) {
-        suitCounts[card.get_suit()]++;
-    }
+AIPlayer::AIPlayer(const std::string& name, DiscardStrategy strategy)
+    : Player(name), strategy_(strategy) {}
 
-    for (const auto& [suit, count] : suitCounts) {
-        if (count >= 4) return true;
-    }
-    return false;
+std::unique_ptr<Player> AIPlayer::clone() const {
+    return std::make_unique<AIPlayer>(name_, strategy_);
 }
 
-bool AIPlayer::is_almost_straight() const {
-    std::vector<int> ranks;
-    for (const auto& card : hand_.get_cards()) {
-        ranks.push_back(static_cast<int>(card.get_rank()));
+namespace {
+
+// 排好序的（点数下标, 位置）
+using RankedPositions = std::array<std::pair<std::uint32_t, size_t>, PackedHand::CAPACITY>;
+
+// 检查是否接近同花：某种花色至少4张
+std::optional<Suit> almost_flush_suit(const HandState& state) {
+    for (unsigned suit = 0; suit < Deck::NUM_SUITS; ++suit) {
+        if (state.suit_count(static_cast<Suit>(suit)) >= 4) {
+            return static_cast<Suit>(suit);
+        }
     }
-    std::sort(ranks.begin(), ranks.end());
+    return std::nullopt;
+}
 
-    // 检查是否有4张连续的牌
+// 检查是否接近顺子：有4张连续的牌
+bool is_almost_straight(const RankedPositions& ranks, size_t count) {
     int consecutive = 1;
-    for (size_t i = 1; i < ranks.size(); ++i) {
-        if (ranks[i] == ranks[i-1] + 1) {
+    for (size_t i = 1; i < count; ++i) {
+        if (ranks[i].first == ranks[i - 1].first + 1) {
             consecutive++;
             if (consecutive >= 4) return true;
-        } else if (ranks[i] != ranks[i-1]) {
+        } else if (ranks[i].first != ranks[i - 1].first) {
             consecutive = 1;
         }
     }
-
     return false;
 }
 
-std::vector<size_t> AIPlayer::analyze_hand() {
-    HandEvaluation eval = HandEvaluator::evaluate(hand_);
-    std::vector<size_t> cardsToReplace;
+// 经验换牌规则：牌型、点数张数、花色张数都直接取自增量状态，只有找顺子时需要按点数排序
+// CardType 为 Card 或 PackedCard
+template <typename CardType>
+DiscardMask heuristic_discards(std::span<const CardType> cards, const HandState& state) {
+    const HandRank rank = HandEvaluator::strength_to_rank(HandEvaluator::evaluate_strength(state));
+    DiscardMask discards = 0;
 
-    // 如果已经有好牌，不换牌
-    if (eval.rank >= HandRank::ThreeOfKind) {
-        return cardsToReplace;
-    }
-
-    // 统计每个点数的数量
-    std::map<Rank, std::vector<size_t>> rankPositions;
-    for (size_t i = 0; i < hand_.get_cards().size(); ++i) {
-        rankPositions[hand_.get_cards()[i].get_rank()].push_back(i);
-    }
-
-    // 两对：不换牌
-    if (eval.rank == HandRank::TwoPair) {
-        return cardsToReplace;
+    // 如果已经有好牌，或者是两对：不换牌
+    if (rank >= HandRank::ThreeOfKind || rank == HandRank::TwoPair) {
+        return discards;
     }
 
     // 一对：换掉非对子的牌
-    if (eval.rank == HandRank::OnePair) {
-        for (const auto& [rank, positions] : rankPositions) {
-            if (positions.size() == 1) {
-                cardsToReplace.push_back(positions[0]);
+    if (rank == HandRank::OnePair) {
+        for (size_t i = 0; i < cards.size(); ++i) {
+            if (state.rank_count(cards[i].get_rank()) == 1) {
+                discards |= static_cast<DiscardMask>(1U << i);
             }
         }
-        return cardsToReplace;
+        return discards;
     }
 
     // 接近同花：只换一张不同花色的牌
-    if (is_almost_flush()) {
-        std::map<Suit, int> suitCounts;
-        Suit majorSuit;
-        int maxCount = 0;
-
-        for (const auto& card : hand_.get_cards()) {
-            suitCounts[card.get_suit()]++;
-            if (suitCounts[card.get_suit()] > maxCount) {
-                maxCount = suitCounts[card.get_suit()];
-                majorSuit = card.get_suit();
+    if (const auto majorSuit = almost_flush_suit(state)) {
+        for (size_t i = 0; i < cards.size(); ++i) {
+            if (cards[i].get_suit() != *majorSuit) {
+                return static_cast<DiscardMask>(1U << i);
             }
         }
+    }
 
-        for (size_t i = 0; i < hand_.get_cards().size(); ++i) {
-            if (hand_.get_cards()[i].get_suit() != majorSuit) {
-                cardsToReplace.push_back(i);
-                return cardsToReplace;
-            }
-        }
+    RankedPositions ranksWithPos{};
+    for (size_t i = 0; i < cards.size(); ++i) {
+        ranksWithPos[i] = {static_cast<std::uint32_t>(cards[i].get_rank()) - 1, i};
     }
+    std::sort(ranksWithPos.begin(), ranksWithPos.begin() + cards.size());
 
     // 接近顺子：换掉不连续的牌
-    if (is_almost_straight()) {
-        std::vector<std::pair<int, size_t>> ranksWithPos;
-        for (size_t i = 0; i < hand_.get_cards().size(); ++i) {
-            ranksWithPos.push_back({static_cast<int>(hand_.get_cards()[i].get_rank()), i});
-        }
-        std::sort(ranksWithPos.begin(), ranksWithPos.end());
-
+    if (is_almost_straight(ranksWithPos, cards.size())) {
         // 找到最长连续序列，换掉其他的牌
-        int bestStart = 0, bestLen = 1;
-        int currentStart = 0, currentLen = 1;
+        size_t bestStart = 0, bestLen = 1;
+        size_t currentStart = 0, currentLen = 1;
 
-        for (size_t i = 1; i < ranksWithPos.size(); ++i) {
-            if (ranksWithPos[i].first == ranksWithPos[i-1].first + 1) {
+        for (size_t i = 1; i < cards.size(); ++i) {
+            if (ranksWithPos[i].first == ranksWithPos[i - 1].first + 1) {
                 currentLen++;
             } else {
                 if (currentLen > bestLen) {
@@ -171,34 +180,56 @@ std::vector<size_t> AIPlayer::analyze_hand() {
             bestStart = currentStart;
         }
 
-        // 换掉不在最长连续序列中的牌
-        for (size_t i = 0; i < ranksWithPos.size(); ++i) {
-            if (i < static_cast<size_t>(bestStart) || i >= static_cast<size_t>(bestStart + bestLen)) {
-                cardsToReplace.push_back(ranksWithPos[i].second);
+        for (size_t i = 0; i < cards.size(); ++i) {
+            if (i < bestStart || i >= bestStart + bestLen) {
+                discards |= static_cast<DiscardMask>(1U << ranksWithPos[i].second);
             }
         }
 
-        if (cardsToReplace.size() <= 2) {
-            return cardsToReplace;
+        if (std::popcount(discards) <= 2) {
+            return discards;
         }
     }
 
     // 高牌：换掉最小的3张牌
-    std::vector<std::pair<Rank, size_t>> ranksWithPos;
-    for (size_t i = 0; i < hand_.get_cards().size(); ++i) {
-        ranksWithPos.push_back({hand_.get_cards()[i].get_rank(), i});
+    for (size_t i = 0; i < 3 && i < cards.size(); ++i) {
+        discards |= static_cast<DiscardMask>(1U << ranksWithPos[i].second);
     }
-    std::sort(ranksWithPos.begin(), ranksWithPos.end());
 
-    for (size_t i = 0; i < 3 && i < ranksWithPos.size(); ++i) {
-        cardsToReplace.push_back(ranksWithPos[i].second);
-    }
+    return discards;
+}
 
-    return cardsToReplace;
+} // namespace
+
+DiscardMask AIPlayer::choose_discards(const PackedHand& hand) {
+    return choose_discards(hand, HandState(hand.get_cards()));
+}
+
+DiscardMask AIPlayer::choose_discards(const PackedHand& hand, const HandState& state) {
+    return heuristic_discards(hand.get_cards(), state);
+}
+
+DiscardMask AIPlayer::choose_discards(const Hand& hand) {
+    return heuristic_discards(hand.get_cards(), hand.state());
+}
+
+DiscardMask AIPlayer::analyze_hand() const {
+    switch (strategy_) {
+        case DiscardStrategy::Heuristic: return choose_discards(hand_);
+        case DiscardStrategy::Optimal:   return DrawOptimizer::optimize(PackedHand(hand_)).best_discards;
+        case DiscardStrategy::StandPat:  return 0;
+    }
+    return 0;
 }
 
-std::vector<size_t> AIPlayer::decide_cards_to_replace() {
+DiscardMask AIPlayer::decide_discards() {
     return analyze_hand();
 }
 
+bool AIPlayer::decide_bet(BetHistory history, size_t /*opponentDraws*/) {
+    const HandRank rank = HandEvaluator::strength_to_rank(HandEvaluator::evaluate_strength(PackedHand(hand_)));
+    const bool facingBet = history == BetHistory::Bet || history == BetHistory::CheckBet;
+    return rank >= (facingBet ? HandRank::OnePair : HandRank::TwoPair);
+}
+
 } // namespace Poker
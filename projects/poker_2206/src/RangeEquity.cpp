@@ -0,0 +1,256 @@
+#include "RangeEquity.h"
+#include "Deck.h"
+#include "DrawOptimizer.h"
+#include "HandComparator.h"
+#include "HandEvaluator.h"
+#include "Random.h"
+#include "WorkStealingPool.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <random>
+#include <stdexcept>
+
+namespace Poker {
+
+namespace {
+
+constexpr size_t LIVE_SIZE = Deck::DECK_SIZE - 2 * Hand::HAND_SIZE;
+
+// 一手起手牌的预处理结果：换哪几张（与对手无关，每手牌只算一次）
+struct PreparedHand {
+    PackedHand hand;
+    std::array<std::uint8_t, Hand::HAND_SIZE> positions{};  // 要换掉的位置
+    size_t draws = 0;
+};
+
+// 换牌后的一种结果：补到的牌（64位掩码）和最终的比较分值
+struct Outcome {
+    std::uint64_t drawn;
+    HandScore score;
+};
+
+std::uint64_t binomial(size_t n, size_t k) noexcept {
+    std::uint64_t result = 1;
+    for (size_t i = 1; i <= k; ++i) {
+        result = result * (n - k + i) / i;
+    }
+    return result;
+}
+
+PreparedHand prepare(const PackedHand& hand, DiscardStrategy strategy) {
+    if (!hand.is_full() || std::popcount(hand.mask()) != static_cast<int>(Hand::HAND_SIZE)) {
+        throw std::invalid_argument("需要5张不同的牌");
+    }
+
+    std::uint8_t discards = 0;
+    switch (strategy) {
+        case DiscardStrategy::Heuristic: discards = AIPlayer::choose_discards(hand);             break;
+        case DiscardStrategy::Optimal:   discards = DrawOptimizer::optimize(hand).best_discards; break;
+        case DiscardStrategy::StandPat:  discards = 0;                                           break;
+    }
+
+    PreparedHand prepared{hand};
+    for (size_t i = 0; i < Hand::HAND_SIZE; ++i) {
+        if (discards & (1U << i)) {
+            prepared.positions[prepared.draws++] = static_cast<std::uint8_t>(i);
+        }
+    }
+    return prepared;
+}
+
+// 从 live[from..] 中依次选牌补到剩余的换牌位置，收集所有结果
+void enumerate_draws(PackedHand hand, const PreparedHand& prepared, size_t depth,
+                     const std::array<PackedCard, LIVE_SIZE>& live, size_t from,
+                     std::uint64_t drawn, std::vector<Outcome>& out) {
+    if (depth == prepared.draws) {
+        out.push_back({drawn, HandEvaluator::evaluate_score(hand)});
+        return;
+    }
+    for (size_t i = from; i + (prepared.draws - depth) <= LIVE_SIZE; ++i) {
+        hand.replace_card(prepared.positions[depth], live[i]);
+        enumerate_draws(hand, prepared, depth + 1, live, i + 1, drawn | live[i].mask_bit(), out);
+    }
+}
+
+void record(MatchupResult& result, ComparisonResult outcome) noexcept {
+    switch (outcome) {
+        case ComparisonResult::Hand1Wins: ++result.wins;   break;
+        case ComparisonResult::Tie:       ++result.ties;   break;
+        case ComparisonResult::Hand2Wins: ++result.losses; break;
+    }
+}
+
+// 单组对局的计算器，每个线程复用自己的缓冲区
+class MatchupSolver {
+public:
+    explicit MatchupSolver(const RangeEquityOptions& options) : options_(options) {}
+
+    MatchupResult solve(const PreparedHand& hand1, const PreparedHand& hand2, std::uint64_t seed) {
+        if ((hand1.hand.mask() & hand2.hand.mask()) != 0) {
+            return {};
+        }
+
+        size_t count = 0;
+        for (unsigned index = 0; index < Deck::DECK_SIZE; ++index) {
+            const PackedCard card = PackedCard::from_index(index);
+            if (!hand1.hand.contains(card) && !hand2.hand.contains(card)) {
+                live_[count++] = card;
+            }
+        }
+
+        // 穷举时两边的结果两两配对（再跳过补到同一张牌的组合），代价为两边组合数之积
+        const std::uint64_t cost = binomial(LIVE_SIZE, hand1.draws) * binomial(LIVE_SIZE, hand2.draws);
+        return cost <= options_.exhaustive_limit ? exhaustive(hand1, hand2) : monte_carlo(hand1, hand2, seed);
+    }
+
+private:
+    // 所有补牌组合等概率：双方补牌是剩余42张中两个互不相交的子集
+    MatchupResult exhaustive(const PreparedHand& hand1, const PreparedHand& hand2) {
+        outcomes1_.clear();
+        outcomes2_.clear();
+        enumerate_draws(hand1.hand, hand1, 0, live_, 0, 0, outcomes1_);
+        enumerate_draws(hand2.hand, hand2, 0, live_, 0, 0, outcomes2_);
+
+        MatchupResult result;
+        result.exhaustive = true;
+        for (const Outcome& a : outcomes1_) {
+            for (const Outcome& b : outcomes2_) {
+                if ((a.drawn & b.drawn) == 0) {
+                    record(result, HandComparator::compare_scores(a.score, b.score));
+                }
+            }
+        }
+        return result;
+    }
+
+    MatchupResult monte_carlo(const PreparedHand& hand1, const PreparedHand& hand2, std::uint64_t seed) {
+        Xoshiro256StarStar rng(seed);
+        const size_t draws = hand1.draws + hand2.draws;
+
+        MatchupResult result;
+        for (std::uint64_t trial = 0; trial < options_.monte_carlo_trials; ++trial) {
+            // 牌堆不需要复原，任意排列再部分打乱仍是均匀分布
+            partial_shuffle(std::span<PackedCard>(live_), draws, rng);
+
+            PackedHand final1 = hand1.hand;
+            PackedHand final2 = hand2.hand;
+            for (size_t i = 0; i < hand1.draws; ++i) {
+                final1.replace_card(hand1.positions[i], live_[i]);
+            }
+            for (size_t i = 0; i < hand2.draws; ++i) {
+                final2.replace_card(hand2.positions[i], live_[hand1.draws + i]);
+            }
+            record(result, HandComparator::compare_scores(HandEvaluator::evaluate_score(final1),
+                                                          HandEvaluator::evaluate_score(final2)));
+        }
+        return result;
+    }
+
+    const RangeEquityOptions& options_;
+    std::array<PackedCard, LIVE_SIZE> live_{};
+    std::vector<Outcome> outcomes1_;
+    std::vector<Outcome> outcomes2_;
+};
+
+// 每组对局独立的随机种子，结果与线程数和任务调度顺序无关
+std::uint64_t cell_seed(std::uint64_t seed, std::uint64_t cell) noexcept {
+    SplitMix64 mixer(seed ^ (cell * 0xD1B54A32D192ED03ULL));
+    return mixer();
+}
+
+std::uint64_t resolve_seed(std::uint64_t seed) {
+    return seed != 0 ? seed : std::random_device{}();
+}
+
+} // namespace
+
+double MatchupResult::equity() const noexcept {
+    const std::uint64_t n = trials();
+    return n == 0 ? 0.0 : (static_cast<double>(wins) + 0.5 * static_cast<double>(ties)) / static_cast<double>(n);
+}
+
+double RangeEquityMatrix::equity() const noexcept {
+    double sum = 0.0;
+    size_t count = 0;
+    for (const auto& cell : cells_) {
+        if (!cell.blocked()) {
+            sum += cell.equity();
+            ++count;
+        }
+    }
+    return count == 0 ? 0.0 : sum / static_cast<double>(count);
+}
+
+double RangeEquityMatrix::row_equity(size_t row) const noexcept {
+    double sum = 0.0;
+    size_t count = 0;
+    for (size_t col = 0; col < cols_; ++col) {
+        const MatchupResult& cell = at(row, col);
+        if (!cell.blocked()) {
+            sum += cell.equity();
+            ++count;
+        }
+    }
+    return count == 0 ? 0.0 : sum / static_cast<double>(count);
+}
+
+RangeEquityMatrix RangeEquity::calculate(std::span<const Hand> range1, std::span<const Hand> range2,
+                                         const RangeEquityOptions& options) {
+    std::vector<PackedHand> packed1(range1.begin(), range1.end());
+    std::vector<PackedHand> packed2(range2.begin(), range2.end());
+    return calculate(std::span<const PackedHand>(packed1), std::span<const PackedHand>(packed2), options);
+}
+
+RangeEquityMatrix RangeEquity::calculate(std::span<const PackedHand> range1, std::span<const PackedHand> range2,
+                                         const RangeEquityOptions& options) {
+    RangeEquityMatrix matrix(range1.size(), range2.size());
+    if (range1.empty() || range2.empty()) {
+        return matrix;
+    }
+
+    const std::uint64_t seed = resolve_seed(options.seed);
+    const size_t tile = std::max<size_t>(1, options.tile_size);
+    const size_t tileRows = (range1.size() + tile - 1) / tile;
+    const size_t tileCols = (range2.size() + tile - 1) / tile;
+
+    WorkStealingPool pool(options.threads);
+
+    // 每手牌的换牌决定只算一次（Optimal 策略下这一步本身就很重）
+    std::vector<PreparedHand> prepared1(range1.size());
+    std::vector<PreparedHand> prepared2(range2.size());
+    pool.parallel_for(range1.size() + range2.size(), [&](size_t i) {
+        if (i < range1.size()) {
+            prepared1[i] = prepare(range1[i], options.strategy);
+        } else {
+            prepared2[i - range1.size()] = prepare(range2[i - range1.size()], options.strategy);
+        }
+    });
+
+    // 一个分块一个任务：能穷举的块很快，要蒙特卡洛的块很慢，由空闲线程窃取来均衡负载
+    pool.parallel_for(tileRows * tileCols, [&](size_t t) {
+        const size_t rowBegin = (t / tileCols) * tile;
+        const size_t colBegin = (t % tileCols) * tile;
+        const size_t rowEnd = std::min(rowBegin + tile, range1.size());
+        const size_t colEnd = std::min(colBegin + tile, range2.size());
+
+        MatchupSolver solver(options);
+        for (size_t row = rowBegin; row < rowEnd; ++row) {
+            for (size_t col = colBegin; col < colEnd; ++col) {
+                matrix.at(row, col) = solver.solve(prepared1[row], prepared2[col],
+                                                   cell_seed(seed, row * range2.size() + col));
+            }
+        }
+    });
+
+    return matrix;
+}
+
+MatchupResult RangeEquity::matchup(const PackedHand& hand1, const PackedHand& hand2,
+                                   const RangeEquityOptions& options) {
+    MatchupSolver solver(options);
+    return solver.solve(prepare(hand1, options.strategy), prepare(hand2, options.strategy),
+                        cell_seed(resolve_seed(options.seed), 0));
+}
+
+} // namespace Poker
@@ -0,0 +1,144 @@
+#include "SevenCardTables.h"
+#include "EvaluatorTables.h"
+#include "PackedCard.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace Poker {
+
+namespace {
+
+using RankCounts = std::array<int, Deck::NUM_RANKS>;
+
+// 一个7张牌的点数组合里最好的5张（不考虑同花）
+// 枚举每个点数取几张，5张牌的点数各不相同时查 unique5 表，否则查 paired 表
+HandStrength best_of_counts(const EvaluatorTables& tables, const RankCounts& counts, size_t rank,
+                            int remaining, std::uint32_t mask, std::uint32_t product) {
+    if (remaining == 0) {
+        return std::popcount(mask) == static_cast<int>(Hand::HAND_SIZE) ? tables.unique5(mask)
+                                                                        : tables.paired(product);
+    }
+    if (rank == Deck::NUM_RANKS) {
+        return 0;
+    }
+
+    HandStrength best = 0;
+    std::uint32_t p = product;
+    for (int take = 0; take <= std::min(counts[rank], remaining); ++take) {
+        const std::uint32_t m = take > 0 ? mask | (1U << rank) : mask;
+        best = std::max(best, best_of_counts(tables, counts, rank + 1, remaining - take, m, p));
+        p *= PackedCard::RANK_PRIMES[rank];
+    }
+    return best;
+}
+
+// 枚举所有7张牌的点数组合（每个点数最多4张）
+void enumerate_counts(RankCounts& counts, size_t rank, int remaining, std::vector<RankCounts>& out) {
+    if (rank == Deck::NUM_RANKS) {
+        if (remaining == 0) {
+            out.push_back(counts);
+        }
+        return;
+    }
+    for (int c = 0; c <= std::min(remaining, 4); ++c) {
+        counts[rank] = c;
+        enumerate_counts(counts, rank + 1, remaining - c, out);
+    }
+    counts[rank] = 0;
+}
+
+} // namespace
+
+const SevenCardTables& SevenCardTables::instance() {
+    static const SevenCardTables tables;
+    return tables;
+}
+
+SevenCardTables::SevenCardTables() {
+    const auto& tables = EvaluatorTables::instance();
+
+    // 点数计数键：每个点数占3位，同一点数的牌相加即为张数
+    for (std::uint32_t mask = 0; mask < RANK_MASK_SIZE; ++mask) {
+        for (size_t r = 0; r < Deck::NUM_RANKS; ++r) {
+            if (mask & (1U << r)) {
+                spread_[mask] += std::uint64_t{1} << (3 * r);
+            }
+        }
+    }
+
+    // 同花：5到7张同花色，取其中所有5张子集的最大值
+    for (std::uint32_t mask = 0; mask < RANK_MASK_SIZE; ++mask) {
+        const int bits = std::popcount(mask);
+        if (bits < 5 || bits > static_cast<int>(HAND_SIZE)) {
+            continue;
+        }
+        for (std::uint32_t sub = mask; sub != 0; sub = (sub - 1) & mask) {
+            if (std::popcount(sub) == static_cast<int>(Hand::HAND_SIZE)) {
+                flush_[mask] = std::max(flush_[mask], tables.flush(sub));
+            }
+        }
+    }
+
+    // 非同花：所有点数组合
+    std::vector<RankCounts> combos;
+    RankCounts counts{};
+    enumerate_counts(counts, 0, static_cast<int>(HAND_SIZE), combos);
+
+    std::vector<std::uint64_t> keys(combos.size());
+    std::vector<HandStrength> values(combos.size());
+    for (size_t i = 0; i < combos.size(); ++i) {
+        for (size_t r = 0; r < Deck::NUM_RANKS; ++r) {
+            keys[i] += static_cast<std::uint64_t>(combos[i][r]) << (3 * r);
+        }
+        values[i] = best_of_counts(tables, combos[i], 0, static_cast<int>(Hand::HAND_SIZE), 0, 1);
+    }
+
+    // 两级完美哈希（与 EvaluatorTables 的 paired 表相同的构造方法）
+    std::vector<std::vector<size_t>> buckets(BUCKETS);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        buckets[mix(keys[i]) >> (64 - BUCKET_BITS)].push_back(i);
+    }
+
+    std::vector<size_t> bucketOrder(BUCKETS);
+    std::iota(bucketOrder.begin(), bucketOrder.end(), 0);
+    std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&](size_t a, size_t b) {
+        return buckets[a].size() > buckets[b].size();  // 先放大桶
+    });
+
+    std::vector<bool> used(SLOTS, false);
+    std::vector<std::uint64_t> slots;
+    for (size_t b : bucketOrder) {
+        if (buckets[b].empty()) {
+            break;
+        }
+
+        bool placed = false;
+        for (std::uint32_t d = 0; d <= 0xFFFF && !placed; ++d) {
+            slots.clear();
+            for (size_t i : buckets[b]) {
+                const std::uint64_t slot = mix(mix(keys[i]) ^ d) & (SLOTS - 1);
+                if (used[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+                    break;
+                }
+                slots.push_back(slot);
+            }
+            if (slots.size() != buckets[b].size()) {
+                continue;
+            }
+
+            displace_[b] = static_cast<std::uint16_t>(d);
+            for (size_t k = 0; k < slots.size(); ++k) {
+                used[slots[k]] = true;
+                ranks_[slots[k]] = values[buckets[b][k]];
+            }
+            placed = true;
+        }
+        if (!placed) {
+            throw std::logic_error("无法构造完美哈希");
+        }
+    }
+}
+
+} // namespace Poker
@@ -0,0 +1,212 @@
+#include "Tournament.h"
+#include "Deck.h"
+#include "Game.h"
+#include "HandEvaluator.h"
+#include "Random.h"
+#include "WorkStealingPool.h"
+#include <atomic>
+#include <chrono>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace Poker {
+
+namespace {
+
+constexpr size_t MAX_PLAYERS = Deck::DECK_SIZE / Hand::HAND_SIZE;
+constexpr size_t ARENA_SIZE = 4096;  // 一桌最多10名玩家加座位表，放得下时不碰全局堆
+
+// 一桌的本地统计
+struct TableStatistics {
+    std::uint64_t hands = 0;
+    std::uint64_t playerHands = 0;
+    std::uint64_t splitPots = 0;
+    std::array<StrategyStatistics, NUM_DISCARD_STRATEGIES> strategies{};
+};
+
+// 无锁汇总：每桌结束时对各计数器做一次原子加法
+// 计数器各占一个缓存行，不同线程同时汇总时不会伪共享
+class ResultAggregator {
+public:
+    void add(const TableStatistics& table) noexcept {
+        hands_.add(table.hands);
+        playerHands_.add(table.playerHands);
+        splitPots_.add(table.splitPots);
+        for (size_t s = 0; s < NUM_DISCARD_STRATEGIES; ++s) {
+            seats_[s].add(table.strategies[s].seats);
+            wins_[s].add(table.strategies[s].wins);
+            ties_[s].add(table.strategies[s].ties);
+        }
+    }
+
+    void collect(TournamentResult& result) const noexcept {
+        result.hands = hands_.get();
+        result.player_hands = playerHands_.get();
+        result.split_pots = splitPots_.get();
+        for (size_t s = 0; s < NUM_DISCARD_STRATEGIES; ++s) {
+            result.strategies[s] = {seats_[s].get(), wins_[s].get(), ties_[s].get()};
+        }
+    }
+
+private:
+    struct alignas(64) Counter {
+        std::atomic<std::uint64_t> value{0};
+
+        void add(std::uint64_t n) noexcept {
+            if (n != 0) {
+                value.fetch_add(n, std::memory_order_relaxed);
+            }
+        }
+        [[nodiscard]] std::uint64_t get() const noexcept { return value.load(std::memory_order_relaxed); }
+    };
+
+    Counter hands_;
+    Counter playerHands_;
+    Counter splitPots_;
+    std::array<Counter, NUM_DISCARD_STRATEGIES> seats_;
+    std::array<Counter, NUM_DISCARD_STRATEGIES> wins_;
+    std::array<Counter, NUM_DISCARD_STRATEGIES> ties_;
+};
+
+// 一张桌子：玩家和座位表从该桌的内存池分配
+class Table {
+public:
+    Table(std::pmr::memory_resource* arena, size_t players, const TournamentOptions& options, std::uint64_t seed)
+        : allocator_(arena), seats_(allocator_), deck_(seed) {
+        seats_.reserve(players);
+        for (size_t i = 0; i < players; ++i) {
+            const DiscardStrategy strategy = options.strategies[i % options.strategies.size()];
+            seats_.push_back(allocator_.new_object<AIPlayer>("座位" + std::to_string(i + 1), strategy));
+        }
+    }
+
+    ~Table() {
+        for (AIPlayer* player : seats_) {
+            allocator_.delete_object(player);
+        }
+    }
+
+    Table(const Table&) = delete;
+    Table& operator=(const Table&) = delete;
+
+    // 玩一手：button 为本手第一个拿牌、第一个换牌的座位
+    void play_hand(size_t button, TableStatistics& statistics) {
+        const size_t players = seats_.size();
+
+        deck_.reset();
+        deck_.shuffle(players * Hand::HAND_SIZE);
+        for (AIPlayer* player : seats_) {
+            player->get_hand().clear();
+        }
+        for (size_t k = 0; k < Hand::HAND_SIZE; ++k) {
+            for (size_t i = 0; i < players; ++i) {
+                if (auto card = deck_.deal_card()) {
+                    seat(button, i).get_hand().add_card(*card);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < players; ++i) {
+            AIPlayer& player = seat(button, i);
+            Game::replace_cards(deck_, player, player.decide_discards());
+        }
+
+        // 比较分值越大越强，与 HandComparator 的结果一致
+        std::array<HandScore, MAX_PLAYERS> scores{};
+        HandScore best = 0;
+        size_t winners = 0;
+        for (size_t i = 0; i < players; ++i) {
+            scores[i] = HandEvaluator::evaluate_score(seats_[i]->get_hand());
+            if (scores[i] > best) {
+                best = scores[i];
+                winners = 1;
+            } else if (scores[i] == best) {
+                ++winners;
+            }
+        }
+
+        ++statistics.hands;
+        statistics.playerHands += players;
+        if (winners > 1) {
+            ++statistics.splitPots;
+        }
+        for (size_t i = 0; i < players; ++i) {
+            StrategyStatistics& s = statistics.strategies[static_cast<size_t>(seats_[i]->get_strategy())];
+            ++s.seats;
+            if (scores[i] == best) {
+                ++(winners == 1 ? s.wins : s.ties);
+            }
+        }
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return seats_.size(); }
+
+private:
+    AIPlayer& seat(size_t button, size_t offset) noexcept {
+        return *seats_[(button + offset) % seats_.size()];
+    }
+
+    std::pmr::polymorphic_allocator<> allocator_;
+    std::pmr::vector<AIPlayer*> seats_;
+    Deck deck_;
+};
+
+std::uint64_t table_seed(std::uint64_t seed, std::uint64_t table) noexcept {
+    SplitMix64 mixer(seed ^ (table * 0xD1B54A32D192ED03ULL));
+    return mixer();
+}
+
+} // namespace
+
+Tournament::Tournament(TournamentOptions options) : options_(std::move(options)) {
+    if (options_.min_players < 2 || options_.max_players > MAX_PLAYERS ||
+        options_.min_players > options_.max_players) {
+        throw std::invalid_argument("每桌人数必须在 2 到 10 之间");
+    }
+    if (options_.strategies.empty()) {
+        throw std::invalid_argument("至少需要一种换牌策略");
+    }
+}
+
+TournamentResult Tournament::run() {
+    const std::uint64_t seed = options_.seed != 0
+        ? options_.seed
+        : (std::uint64_t{std::random_device{}()} << 32) | std::random_device{}();
+
+    WorkStealingPool pool(options_.threads);
+    ResultAggregator aggregator;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    // 每桌一个任务：桌子的人数、牌堆种子只取决于桌号，结果与线程数无关
+    pool.parallel_for(options_.tables, [&](size_t index) {
+        const std::uint64_t tableSeed = table_seed(seed, index);
+        SplitMix64 rng(tableSeed);
+        const size_t players = options_.min_players +
+            bounded(rng, static_cast<std::uint32_t>(options_.max_players - options_.min_players + 1));
+
+        std::array<std::byte, ARENA_SIZE> buffer;
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+        Table table(&arena, players, options_, rng());
+
+        TableStatistics statistics;
+        for (std::uint64_t hand = 0; hand < options_.hands_per_table; ++hand) {
+            table.play_hand(hand % players, statistics);
+        }
+        aggregator.add(statistics);
+    });
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    TournamentResult result;
+    aggregator.collect(result);
+    result.tables = options_.tables;
+    result.threads = pool.thread_count();
+    result.seconds = elapsed.count();
+    result.hands_per_second = elapsed.count() > 0.0 ? static_cast<double>(result.hands) / elapsed.count() : 0.0;
+    return result;
+}
+
+} // namespace Poker
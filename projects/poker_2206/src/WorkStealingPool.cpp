@@ -0,0 +1,153 @@
+#include "WorkStealingPool.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace Poker {
+
+namespace {
+
+// 当前线程所属的线程池和队列编号（非工作线程为 nullptr）
+thread_local const WorkStealingPool* currentPool = nullptr;
+thread_local size_t currentIndex = 0;
+
+} // namespace
+
+WorkStealingPool::WorkStealingPool(size_t threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    queues_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    // 所有队列就绪后再启动线程
+    threads_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        threads_.emplace_back(&WorkStealingPool::worker_loop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        stopping_ = true;
+    }
+    wakeup_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void WorkStealingPool::submit(Task task) {
+    const size_t index = currentPool == this
+        ? currentIndex
+        : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    {
+        // 在锁内增加计数，避免工作线程检查完条件、尚未睡眠时丢失通知
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        queued_.fetch_add(1, std::memory_order_relaxed);
+    }
+    wakeup_.notify_one();
+}
+
+void WorkStealingPool::wait() {
+    if (on_worker_thread()) {
+        throw std::logic_error("不能在线程池的任务中调用 wait()");
+    }
+
+    std::unique_lock<std::mutex> lock(stateMutex_);
+    idle_.wait(lock, [this] { return pending_.load(std::memory_order_acquire) == 0; });
+
+    if (error_) {
+        std::exception_ptr error = std::exchange(error_, nullptr);
+        lock.unlock();
+        std::rethrow_exception(error);
+    }
+}
+
+bool WorkStealingPool::try_pop(size_t self, Task& task) {
+    Queue& queue = *queues_[self];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::try_steal(size_t self, Task& task) {
+    for (size_t offset = 1; offset < queues_.size(); ++offset) {
+        Queue& queue = *queues_[(self + offset) % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::run(Task& task) {
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    try {
+        task();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        if (!error_) {
+            error_ = std::current_exception();
+        }
+    }
+    task = nullptr;
+
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        idle_.notify_all();
+    }
+}
+
+bool WorkStealingPool::on_worker_thread() const noexcept {
+    return currentPool == this;
+}
+
+void WorkStealingPool::help_until(const std::atomic<size_t>& remaining) {
+    Task task;
+    while (remaining.load(std::memory_order_acquire) != 0) {
+        if (try_pop(currentIndex, task) || try_steal(currentIndex, task)) {
+            run(task);
+        } else {
+            // 剩余的任务正在其他线程上执行
+            std::this_thread::yield();
+        }
+    }
+}
+
+void WorkStealingPool::worker_loop(size_t index) {
+    currentPool = this;
+    currentIndex = index;
+
+    Task task;
+    for (;;) {
+        if (try_pop(index, task) || try_steal(index, task)) {
+            run(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(stateMutex_);
+        wakeup_.wait(lock, [this] { return stopping_ || queued_.load(std::memory_order_relaxed) > 0; });
+        if (stopping_ && queued_.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+    }
+}
+
+} // namespace Poker
@@ -1,8 +1,198 @@
+#include "CfrSolver.h"
 #include "Game.h"
+#include "HandHistory.h"
+#include "Tournament.h"
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 
-int main() {
+namespace {
+
+// 无界面模拟：两名 AI 对战，输出统计和每秒局数
+// 用法: poker_2206 --simulate <局数> [--threads <线程数>] [--seed <种子>] [--history <记录文件>]
+//                  [--cfr <检查点>]（玩家2改用 CFR 策略换牌和下注）
+int run_simulation(int argc, char* argv[]) {
+    std::uint64_t rounds = 1'000'000;
+    size_t threads = 0;
+    std::uint64_t seed = 0;
+    std::string historyPath;
+    std::string cfrPath;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--simulate") == 0 && hasValue) {
+            rounds = std::stoull(argv[++i]);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            threads = std::stoul(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && hasValue) {
+            seed = std::stoull(argv[++i]);
+        } else if (std::strcmp(argv[i], "--history") == 0 && hasValue) {
+            historyPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--cfr") == 0 && hasValue) {
+            cfrPath = argv[++i];
+        }
+    }
+
+    std::unique_ptr<Poker::Player> player2;
+    if (cfrPath.empty()) {
+        player2 = std::make_unique<Poker::AIPlayer>("AI-2");
+    } else {
+        Poker::CfrSolver solver;
+        solver.load_checkpoint(cfrPath);
+        player2 = std::make_unique<Poker::CfrPlayer>("CFR", solver.strategy());
+    }
+
+    std::unique_ptr<Poker::HandHistoryWriter> history;
+    if (!historyPath.empty()) {
+        history = std::make_unique<Poker::HandHistoryWriter>(historyPath);
+    }
+
+    Poker::Game game(std::make_unique<Poker::AIPlayer>("AI-1"), std::move(player2));
+    const Poker::SimulationReport report = game.simulate(rounds, threads, seed, history.get());
+
+    game.show_statistics();
+    std::cout << "线程数: " << report.threads << "\n";
+    std::cout << "用时: " << report.seconds << " 秒\n";
+    std::cout << "每秒局数: " << static_cast<std::uint64_t>(report.rounds_per_second) << "\n";
+    return 0;
+}
+
+// 读取牌局记录：按玩家2（庄家）的换牌张数统计胜率
+// 用法: poker_2206 --read-history <记录文件>
+int run_history_report(const std::string& path) {
+    const Poker::HandHistoryReader reader(path);
+    std::cout << "局数: " << reader.size() << " (" << reader.block_count() << " 块)\n";
+
+    for (int drawn = 0; drawn <= static_cast<int>(Poker::Hand::HAND_SIZE); ++drawn) {
+        const size_t won = reader.find_rounds(1, drawn, true).size();
+        const size_t lost = reader.find_rounds(1, drawn, false).size();
+        if (won + lost > 0) {
+            std::cout << "庄家换 " << drawn << " 张: " << won + lost << " 局, 胜 " << won << " ("
+                      << static_cast<double>(won) * 100.0 / static_cast<double>(won + lost) << "%)\n";
+        }
+    }
+    return 0;
+}
+
+Poker::DiscardStrategy parse_strategy(const std::string& name) {
+    if (name == "heuristic") return Poker::DiscardStrategy::Heuristic;
+    if (name == "optimal")   return Poker::DiscardStrategy::Optimal;
+    if (name == "standpat")  return Poker::DiscardStrategy::StandPat;
+    throw std::invalid_argument("未知的换牌策略: " + name);
+}
+
+// 多桌模拟：每桌 2-10 名 AI，输出各策略的胜率和每秒手数
+// 用法: poker_2206 --tournament <桌数> [--hands <每桌手数>] [--min-players <n>] [--max-players <n>]
+//                  [--strategies heuristic,optimal,standpat] [--threads <线程数>] [--seed <种子>]
+int run_tournament(int argc, char* argv[]) {
+    Poker::TournamentOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--tournament") == 0 && hasValue) {
+            options.tables = std::stoul(argv[++i]);
+        } else if (std::strcmp(argv[i], "--hands") == 0 && hasValue) {
+            options.hands_per_table = std::stoull(argv[++i]);
+        } else if (std::strcmp(argv[i], "--min-players") == 0 && hasValue) {
+            options.min_players = std::stoul(argv[++i]);
+        } else if (std::strcmp(argv[i], "--max-players") == 0 && hasValue) {
+            options.max_players = std::stoul(argv[++i]);
+        } else if (std::strcmp(argv[i], "--strategies") == 0 && hasValue) {
+            options.strategies.clear();
+            std::istringstream names(argv[++i]);
+            for (std::string name; std::getline(names, name, ',');) {
+                options.strategies.push_back(parse_strategy(name));
+            }
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            options.threads = std::stoul(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && hasValue) {
+            options.seed = std::stoull(argv[++i]);
+        }
+    }
+
+    const Poker::TournamentResult result = Poker::Tournament(options).run();
+
+    static constexpr const char* STRATEGY_NAMES[] = {"heuristic", "optimal", "standpat"};
+    std::cout << "桌数: " << result.tables << "\n";
+    std::cout << "总手数: " << result.hands << " (座位手数 " << result.player_hands << ")\n";
+    for (size_t s = 0; s < Poker::NUM_DISCARD_STRATEGIES; ++s) {
+        const auto& statistics = result.strategies[s];
+        if (statistics.seats > 0) {
+            std::cout << STRATEGY_NAMES[s] << ": 胜率 " << statistics.win_rate() * 100.0 << "% ("
+                      << statistics.wins << " / " << statistics.seats << ")\n";
+        }
+    }
+    std::cout << "线程数: " << result.threads << "\n";
+    std::cout << "用时: " << result.seconds << " 秒\n";
+    std::cout << "每秒手数: " << static_cast<std::uint64_t>(result.hands_per_second) << "\n";
+    return 0;
+}
+
+// 训练 CFR 策略，结束后与启发式 AI 对战 100 万局（庄家座位）检验换牌和下注策略
+// 用法: poker_2206 --train-cfr <迭代次数> [--samples <每次迭代的发牌数>] [--threads <线程数>] [--seed <种子>]
+//                  [--checkpoint <检查点>] [--resume]（从检查点继续训练）
+int run_cfr_training(int argc, char* argv[]) {
+    Poker::CfrOptions options;
+    bool resume = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--train-cfr") == 0 && hasValue) {
+            options.iterations = std::stoull(argv[++i]);
+        } else if (std::strcmp(argv[i], "--samples") == 0 && hasValue) {
+            options.samples_per_iteration = std::stoull(argv[++i]);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            options.threads = std::stoul(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && hasValue) {
+            options.seed = std::stoull(argv[++i]);
+        } else if (std::strcmp(argv[i], "--checkpoint") == 0 && hasValue) {
+            options.checkpoint_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--resume") == 0) {
+            resume = true;
+        }
+    }
+
+    Poker::CfrSolver solver(options);
+    if (resume && !options.checkpoint_path.empty()) {
+        solver.load_checkpoint(options.checkpoint_path);
+        std::cout << "从第 " << solver.iteration() << " 次迭代继续训练\n";
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    solver.train();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "迭代次数: " << solver.iteration() << "\n";
+    std::cout << "训练用时: " << elapsed.count() << " 秒\n";
+
+    Poker::Game game(std::make_unique<Poker::AIPlayer>("AI"),
+                     std::make_unique<Poker::CfrPlayer>("CFR", solver.strategy()));
+    game.simulate(1'000'000, options.threads, options.seed);
+    game.show_statistics();
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
     try {
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--simulate") == 0) {
+                return run_simulation(argc, argv);
+            }
+            if (std::strcmp(argv[i], "--tournament") == 0) {
+                return run_tournament(argc, argv);
+            }
+            if (std::strcmp(argv[i], "--train-cfr") == 0) {
+                return run_cfr_training(argc, argv);
+            }
+            if (std::strcmp(argv[i], "--read-history") == 0 && i + 1 < argc) {
+                return run_history_report(argv[i + 1]);
+            }
+        }
+
         Poker::Game game;
         game.start();
     } catch (const std::exception& e) {
@@ -10,4 +200,4 @@ int main() {
         return 1;
     }
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,88 @@
+#include "../include/ProgramBuilder.h"
+#include "VirtualMachine.h"
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/**
+ * @file vm_bench.cpp
+ * @brief 解释器性能基准
+ *
+ * 比较同一个循环程序在以下情况下的每条指令耗时：
+ * - 普通执行（未设置任何调试点）
+ * - 设置后又移除观察点（确认调试路径被完全关闭）
+ * - 观察点已设置但从不命中（调试路径的开销）
+ */
+
+namespace
+{
+
+constexpr int LOOP_COUNT = 5'000'000; // 倒计数次数
+constexpr int REPEATS = 5;            // 每种情况取最快的一次
+
+// 倒计数循环：每轮 5 条指令
+// 00: LOAD 20    01: SUB 21    02: STORE 20    03: JMPZERO 05    04: JMP 00    05: HALT
+std::array<int, VMContext::MEMORY_SIZE> buildCountdownProgram()
+{
+    return ProgramBuilder()
+        .addInstruction(+2020)
+        .addInstruction(+3121)
+        .addInstruction(+2120)
+        .addInstruction(+4205)
+        .addInstruction(+4000)
+        .addInstruction(+4300)
+        .setData(20, LOOP_COUNT)
+        .setData(21, 1)
+        .build();
+}
+
+void runCase(const std::string& name, const std::function<void(VirtualMachine&)>& setup)
+{
+    const auto program = buildCountdownProgram();
+    double best = 0.0;
+    std::uint64_t steps = 0;
+
+    for (int i = 0; i < REPEATS; ++i)
+    {
+        VirtualMachine vm;
+        vm.setConsoleIO(false);
+        setup(vm);
+        vm.loadProgram(program);
+
+        const auto start = std::chrono::steady_clock::now();
+        vm.execute();
+        const std::chrono::duration<double, std::nano> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        steps = vm.getSteps();
+        const double perInstruction = elapsed.count() / static_cast<double>(steps);
+        if (i == 0 || perInstruction < best)
+        {
+            best = perInstruction;
+        }
+    }
+
+    std::cout << std::left << std::setw(28) << name << std::right << std::setw(12) << steps
+              << " 条指令 " << std::fixed << std::setprecision(2) << std::setw(8) << best
+              << " ns/指令" << std::endl;
+}
+
+} // namespace
+
+int main()
+{
+    std::cout << "=== 解释器基准 ===" << std::endl;
+
+    runCase("普通执行", [](VirtualMachine&) {});
+    runCase("观察点已移除", [](VirtualMachine& vm) {
+        vm.addWatchpoint(50);
+        vm.removeWatchpoint(50);
+    });
+    runCase("观察点已设置（未命中）", [](VirtualMachine& vm) { vm.addWatchpoint(50); });
+    runCase("条件断点已设置（未命中）", [](VirtualMachine& vm) { vm.addBreakpoint(99); });
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+/**
+ * @file Breakpoint.h
+ * @brief 调试支持：内存观察点、条件断点和停止原因
+ */
+
+/**
+ * @enum WatchType
+ * @brief 观察点监视的访问类型（位标志，可组合）
+ */
+enum class WatchType : unsigned
+{
+    Read = 1,     // 读取该内存单元时停止
+    Write = 2,    // 写入该内存单元时停止
+    ReadWrite = 3 // 读或写时停止
+};
+
+/**
+ * @enum Comparison
+ * @brief 条件断点的比较方式
+ */
+enum class Comparison
+{
+    Equal,
+    NotEqual,
+    Less,
+    Greater
+};
+
+/**
+ * @struct AccumulatorCondition
+ * @brief 累加器条件：accumulator <op> value
+ */
+struct AccumulatorCondition
+{
+    Comparison op{Comparison::Equal};
+    int value{0};
+
+    [[nodiscard]] bool matches(int accumulator) const
+    {
+        switch (op)
+        {
+        case Comparison::Equal:
+            return accumulator == value;
+        case Comparison::NotEqual:
+            return accumulator != value;
+        case Comparison::Less:
+            return accumulator < value;
+        case Comparison::Greater:
+            return accumulator > value;
+        }
+        return false;
+    }
+};
+
+/**
+ * @struct Breakpoint
+ * @brief 条件断点
+ *
+ * 在指令执行之前检查：
+ * - 只设置 pc：执行到该地址时停止
+ * - 只设置 condition：累加器从“不满足”变为“满足”时停止（边沿触发，避免每条指令都停）
+ * - 两者都设置：执行到该地址且累加器满足条件时停止
+ */
+struct Breakpoint
+{
+    std::optional<int> pc;                          // 指令地址
+    std::optional<AccumulatorCondition> condition;  // 累加器条件
+    bool lastMatched{false};                        // 仅条件断点使用：上一次检查是否满足
+};
+
+/**
+ * @enum StopReason
+ * @brief 虚拟机停止执行的原因
+ */
+enum class StopReason
+{
+    None,       // 尚未执行
+    Halted,     // 执行了 HALT
+    Error,      // 运行时错误
+    Breakpoint, // 命中断点
+    Watchpoint  // 命中观察点
+};
+
+/**
+ * @struct StopEvent
+ * @brief 停止事件详情
+ */
+struct StopEvent
+{
+    StopReason reason{StopReason::None};
+    int pc{0};                  // 停止时的指令地址（断点/观察点停在指令执行之前）
+    size_t breakpointIndex{0};  // 命中的断点序号（reason == Breakpoint）
+    size_t address{0};          // 被访问的内存地址（reason == Watchpoint）
+    WatchType access{WatchType::Read}; // 访问类型（reason == Watchpoint）
+};
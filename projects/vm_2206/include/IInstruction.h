@@ -12,6 +12,19 @@
  * 每个指令都是一个独立的命令对象
  */
 
+/**
+ * @enum MemoryAccess
+ * @brief 指令对操作数地址的内存访问方式
+ *
+ * 调试器据此判断一条指令是否会触发内存观察点
+ */
+enum class MemoryAccess
+{
+    None,  // 不访问内存（跳转、停机）
+    Read,  // 读取 memory[operand]
+    Write  // 写入 memory[operand]
+};
+
 /**
  * @class IInstruction
  * @brief 指令接口（抽象基类）
@@ -50,4 +63,11 @@ public:
      * 其他指令执行后 PC 自动递增
      */
     [[nodiscard]] virtual bool changesPC() const { return false; }
+
+    /**
+     * @brief 获取指令对 memory[operand] 的访问方式
+     *
+     * @return 默认不访问内存，访问内存的指令需要重写
+     */
+    [[nodiscard]] virtual MemoryAccess memoryAccess() const { return MemoryAccess::None; }
 };
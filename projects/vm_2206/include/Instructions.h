@@ -26,6 +26,7 @@ class ReadInstruction : public IInstruction
 public:
     void execute(VMContext& context, int operand) override;
     [[nodiscard]] std::string getName() const override;
+    [[nodiscard]] MemoryAccess memoryAccess() const override;
 };
 
 /**
@@ -39,6 +40,7 @@ class WriteInstruction : public IInstruction
 public:
     void execute(VMContext& context, int operand) override;
     [[nodiscard]] std::string getName() const override;
+    [[nodiscard]] MemoryAccess memoryAccess() const override;
 };
 
 // ==================== 加载/存储指令 ====================
@@ -54,6 +56,7 @@ class LoadInstruction : public IInstruction
 public:
     void execute(VMContext& context, int operand) override;
     [[nodiscard]] std::string getName() const override;
+    [[nodiscard]] MemoryAccess memoryAccess() const override;
 };
 
 /**
@@ -67,6 +70,7 @@ class StoreInstruction : public IInstruction
 public:
     void execute(VMContext& context, int operand) override;
     [[nodiscard]] std::string getName() const override;
+    [[nodiscard]] MemoryAccess memoryAccess() const override;
 };
 
 // ==================== 算术指令 ====================
@@ -94,6 +98,7 @@ protected:
 
 public:
     void execute(VMContext& context, int operand) override;
+    [[nodiscard]] MemoryAccess memoryAccess() const override;
 };
 
 /**
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @file MPMCQueue.h
+ * @brief 有界无锁多生产者多消费者队列
+ *
+ * 基于 Dmitry Vyukov 的有界 MPMC 队列算法：
+ * 每个槽位带一个序号（sequence），生产者和消费者通过 CAS 争抢位置，
+ * 再通过槽位序号判断槽位是否可写/可读，全程不使用互斥锁
+ */
+
+/**
+ * @class MPMCQueue
+ * @brief 有界无锁 MPMC 队列
+ *
+ * @tparam T 元素类型（需可默认构造、可移动）
+ *
+ * 设计特点：
+ * - 容量必须是 2 的幂，下标用位与代替取模
+ * - 入队/出队位置分别放在独立的缓存行，避免伪共享
+ * - 队列满/空时立即返回 false，由调用方决定重试或等待
+ */
+template <typename T>
+class MPMCQueue
+{
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct Slot
+    {
+        std::atomic<size_t> sequence; // 槽位序号：等于 pos 可写，等于 pos+1 可读
+        T value;
+    };
+
+    const size_t mask_;               // 容量 - 1
+    std::unique_ptr<Slot[]> slots_;   // 环形缓冲区
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos_{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePos_{0};
+
+public:
+    /**
+     * @brief 构造函数
+     *
+     * @param capacity 队列容量（必须是 2 的幂且不小于 2）
+     * @throws std::invalid_argument 如果容量不合法
+     */
+    explicit MPMCQueue(size_t capacity) : mask_(capacity - 1), slots_(new Slot[capacity])
+    {
+        if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+        {
+            throw std::invalid_argument("队列容量必须是 2 的幂");
+        }
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    /**
+     * @brief 尝试入队
+     *
+     * @param value 要入队的元素（成功时被移走）
+     * @return true 入队成功，false 队列已满
+     */
+    bool tryPush(T& value)
+    {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot& slot = slots_[pos & mask_];
+            const size_t seq = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+            if (diff == 0)
+            {
+                // 槽位空闲，尝试占有该位置
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    slot.value = std::move(value);
+                    slot.sequence.store(pos + 1, std::memory_order_release); // 发布给消费者
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false; // 槽位仍被上一轮占用：队列已满
+            }
+            else
+            {
+                pos = enqueuePos_.load(std::memory_order_relaxed); // 被其他生产者抢先，重新读取
+            }
+        }
+    }
+
+    /**
+     * @brief 尝试出队
+     *
+     * @param out 出队元素的存放位置
+     * @return true 出队成功，false 队列为空
+     */
+    bool tryPop(T& out)
+    {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot& slot = slots_[pos & mask_];
+            const size_t seq = slot.sequence.load(std::memory_order_acquire);
+            const auto diff =
+                static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+            if (diff == 0)
+            {
+                // 槽位有数据，尝试占有该位置
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    out = std::move(slot.value);
+                    // 标记为下一轮可写
+                    slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false; // 槽位尚未写入：队列为空
+            }
+            else
+            {
+                pos = dequeuePos_.load(std::memory_order_relaxed); // 被其他消费者抢先，重新读取
+            }
+        }
+    }
+
+    /**
+     * @brief 获取队列中元素数量的近似值（并发时仅作统计用途）
+     */
+    [[nodiscard]] size_t sizeApprox() const
+    {
+        const size_t enq = enqueuePos_.load(std::memory_order_relaxed);
+        const size_t deq = dequeuePos_.load(std::memory_order_relaxed);
+        return enq > deq ? enq - deq : 0;
+    }
+
+    /**
+     * @brief 获取队列容量
+     */
+    [[nodiscard]] size_t capacity() const { return mask_ + 1; }
+};
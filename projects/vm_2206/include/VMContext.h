@@ -2,7 +2,9 @@
 
 #include <array>
 #include <concepts>
+#include <span>
 #include <stdexcept>
+#include <vector>
 
 /**
  * @file VMContext.h
@@ -21,6 +23,7 @@ concept Numeric = std::integral<T> || std::floating_point<T>;
  * - 寄存器（accumulator, instructionCounter, instructionRegister）
  * - 内存（100个单元）
  * - 运行状态
+ * - I/O 通道（终端或内存缓冲区）
  */
 class VMContext
 {
@@ -34,10 +37,17 @@ public:
     bool running{false};                   // 运行状态：虚拟机是否正在运行
     std::array<int, MEMORY_SIZE> memory{}; // 内存：存储指令和数据
 
+    // I/O 通道
+    bool consoleIO{true};     // true: READ/WRITE 使用终端；false: 使用下面的缓冲区
+    std::vector<int> inputs;  // 输入缓冲区：READ 依次从这里取值
+    size_t inputCursor{0};    // 下一个要读取的输入位置
+    std::vector<int> outputs; // 输出缓冲区：WRITE 的结果追加到这里
+
     /**
      * @brief 重置虚拟机状态
      *
      * 将所有寄存器和内存清零，停止运行
+     * 清空 I/O 缓冲区但保留其容量，便于同一个上下文反复执行作业而不重新分配内存
      */
     void reset()
     {
@@ -46,8 +56,44 @@ public:
         instructionRegister = 0;
         running = false;
         memory.fill(0);
+        inputs.clear();
+        inputCursor = 0;
+        outputs.clear();
+    }
+
+    /**
+     * @brief 设置输入缓冲区内容（缓冲区模式下供 READ 使用）
+     *
+     * @param values 输入序列
+     */
+    void setInputs(std::span<const int> values)
+    {
+        inputs.assign(values.begin(), values.end());
+        inputCursor = 0;
     }
 
+    /**
+     * @brief 从输入缓冲区读取下一个值
+     *
+     * @return 下一个输入值
+     * @throws std::runtime_error 如果输入已耗尽
+     */
+    int readInput()
+    {
+        if (inputCursor >= inputs.size())
+        {
+            throw std::runtime_error("输入已耗尽");
+        }
+        return inputs[inputCursor++];
+    }
+
+    /**
+     * @brief 向输出缓冲区追加一个值
+     *
+     * @param value 输出值
+     */
+    void writeOutput(int value) { outputs.push_back(value); }
+
     /**
      * @brief 设置内存值
      *
@@ -0,0 +1,189 @@
+#pragma once
+
+#include "MPMCQueue.h"
+#include "VMContext.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @file VMService.h
+ * @brief 虚拟机进程内服务
+ *
+ * 采用 Producer-Consumer 模式 + Thread Pool 模式
+ * 任意线程提交（程序, 输入）作业，固定数量的工作线程各自持有一个可复用的虚拟机执行作业
+ */
+
+/// 程序映像：与 ProgramBuilder::build() 的返回类型一致
+using Program = std::array<int, VMContext::MEMORY_SIZE>;
+
+/**
+ * @struct VMResult
+ * @brief 一个作业的执行结果
+ */
+struct VMResult
+{
+    bool success{false};                 // 是否正常执行到 HALT
+    std::string error;                   // 运行时错误信息（成功时为空）
+    std::vector<int> outputs;            // WRITE 指令的输出
+    int accumulator{0};                  // 结束时累加器的值
+    std::uint64_t steps{0};              // 执行的指令数
+    std::chrono::nanoseconds latency{0}; // 从提交到完成的耗时（含排队时间）
+};
+
+/**
+ * @struct VMServiceMetrics
+ * @brief 服务运行指标快照
+ */
+struct VMServiceMetrics
+{
+    size_t queueDepth{0};            // 当前排队的作业数（近似值）
+    std::uint64_t completedJobs{0};  // 已完成的作业数
+    double jobsPerSecond{0.0};       // 自服务启动以来的平均吞吐量
+    double p50LatencyMicros{0.0};    // 延迟中位数（微秒）
+    double p99LatencyMicros{0.0};    // 99 分位延迟（微秒）
+};
+
+/**
+ * @class VMService
+ * @brief 虚拟机工作线程池
+ *
+ * 设计特点：
+ * - 作业通过有界无锁 MPMC 队列分发，提交方之间、工作线程之间都不加锁
+ * - 每个工作线程拥有一个 VirtualMachine，作业之间通过 reset() 复用上下文和缓冲区
+ * - 结果通过 std::future 返回
+ * - 每个工作线程维护自己的延迟直方图，读取指标时再合并，执行路径上没有共享写
+ */
+class VMService
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief 构造函数：启动工作线程
+     *
+     * @param workerCount 工作线程数（0 表示使用硬件并发数）
+     * @param queueCapacity 队列容量（必须是 2 的幂）
+     * @param stepLimit 每个作业的最大指令数（0 表示不限制）
+     */
+    explicit VMService(size_t workerCount = 0, size_t queueCapacity = 1024,
+                       std::uint64_t stepLimit = 1'000'000);
+
+    /**
+     * @brief 析构函数：等待队列中的作业完成后停止工作线程
+     */
+    ~VMService();
+
+    VMService(const VMService&) = delete;
+    VMService& operator=(const VMService&) = delete;
+
+    /**
+     * @brief 提交作业（队列满时等待）
+     *
+     * @param program 程序映像
+     * @param inputs READ 指令依次读取的输入
+     * @return 作业结果的 future
+     * @throws std::runtime_error 如果服务已停止（包括等待队列空位期间停止）
+     */
+    std::future<VMResult> submit(const Program& program, std::vector<int> inputs = {});
+
+    /**
+     * @brief 尝试提交作业（队列满时立即返回）
+     *
+     * @return 作业结果的 future，队列已满时返回 nullopt
+     * @throws std::runtime_error 如果服务已停止
+     */
+    std::optional<std::future<VMResult>> trySubmit(const Program& program,
+                                                   std::vector<int> inputs = {});
+
+    /**
+     * @brief 停止服务
+     *
+     * 不再接受新作业，工作线程处理完队列中剩余的作业后退出；
+     * 与 shutdown 并发提交、在工作线程退出后才入队的作业以 std::runtime_error 失败
+     */
+    void shutdown();
+
+    /**
+     * @brief 获取运行指标快照
+     */
+    [[nodiscard]] VMServiceMetrics getMetrics() const;
+
+    /**
+     * @brief 获取工作线程数
+     */
+    [[nodiscard]] size_t workerCount() const { return workers_.size(); }
+
+private:
+    // 队列中的作业
+    struct Task
+    {
+        Program program{};
+        std::vector<int> inputs;
+        std::promise<VMResult> promise;
+        Clock::time_point submitTime;
+    };
+
+    /**
+     * @class LatencyHistogram
+     * @brief 对数-线性分桶的延迟直方图（单写多读）
+     *
+     * 每个 2 的幂区间再均分为 8 个子桶，相对误差不超过 12.5%
+     */
+    class LatencyHistogram
+    {
+    public:
+        static constexpr size_t SUB_BUCKETS = 8;
+        static constexpr size_t BUCKET_COUNT = 16 + (64 - 4) * SUB_BUCKETS;
+
+        void record(std::uint64_t nanos);
+        void mergeInto(std::array<std::uint64_t, BUCKET_COUNT>& totals) const;
+        static std::uint64_t bucketLowerBound(size_t index);
+
+    private:
+        std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> counts_{};
+    };
+
+    // 工作线程及其私有统计
+    struct Worker
+    {
+        std::thread thread;
+        LatencyHistogram latency;
+        std::atomic<std::uint64_t> completed{0};
+    };
+
+    MPMCQueue<Task> queue_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::uint64_t stepLimit_;
+    std::atomic<std::uint64_t> submitSignal_{0}; // 每次入队递增，空闲的工作线程在其上等待
+    std::atomic<bool> stopping_{false};
+    std::atomic<size_t> activeSubmitters_{0};    // 正在 submit/trySubmit 中的线程数
+    Clock::time_point startTime_;
+
+    // 提交期间登记为活跃提交方（stopping_ 与计数都使用 seq_cst）
+    struct SubmitGuard
+    {
+        std::atomic<size_t>& count;
+        explicit SubmitGuard(std::atomic<size_t>& c) : count(c) { count.fetch_add(1); }
+        ~SubmitGuard() { count.fetch_sub(1); }
+        SubmitGuard(const SubmitGuard&) = delete;
+        SubmitGuard& operator=(const SubmitGuard&) = delete;
+    };
+
+    // 工作线程主循环
+    void workerLoop(Worker& worker);
+
+    // 构造作业
+    static Task makeTask(const Program& program, std::vector<int> inputs);
+
+    // 唤醒一个空闲的工作线程
+    void notifyWorker();
+};
@@ -1,9 +1,15 @@
 #pragma once
 
+#include "Breakpoint.h"
 #include "InstructionFactory.h"
 #include "VMContext.h"
 
 #include <array>
+#include <bitset>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
 
 /**
  * @file VirtualMachine.h
@@ -33,6 +39,16 @@ class VirtualMachine
 private:
     VMContext context_;                 // 虚拟机上下文（寄存器和内存）
     const InstructionFactory& factory_; // 指令工厂引用
+    std::uint64_t stepLimit_{0};        // 单次执行的最大指令数（0 表示不限制）
+    std::uint64_t steps_{0};            // 上次执行的指令数
+    std::string lastError_;             // 上次执行的运行时错误（为空表示正常结束）
+    StopEvent lastStop_;                // 上次停止的原因
+
+    // 调试状态：只有设置了观察点或断点时才会被执行循环查询
+    std::bitset<VMContext::MEMORY_SIZE> readWatch_;  // 读观察点位图（每个内存单元一位）
+    std::bitset<VMContext::MEMORY_SIZE> writeWatch_; // 写观察点位图
+    std::vector<Breakpoint> breakpoints_;           // 条件断点
+    StopReason resumeFrom_{StopReason::None};       // 恢复执行时第一条指令已检查过的部分
 
     /**
      * @brief 执行单条指令（取指-解码-执行循环）
@@ -41,6 +57,23 @@ private:
      */
     void executeSingleInstruction();
 
+    /**
+     * @brief 执行循环
+     *
+     * @tparam Debug 是否检查断点和观察点
+     *
+     * 没有设置任何断点/观察点时使用 Debug = false 的实例，
+     * 循环中不包含任何调试检查，速度与普通解释器相同
+     */
+    template <bool Debug>
+    void runLoop();
+
+    // 根据是否设置了调试条件选择执行循环
+    void run();
+
+    // 检查当前指令是否命中断点或观察点，命中时填写 lastStop_
+    bool checkDebugStop();
+
 public:
     /**
      * @brief 构造函数
@@ -63,6 +96,98 @@ public:
      */
     void execute();
 
+    /**
+     * @brief 重置虚拟机（寄存器、内存和 I/O 缓冲区）
+     *
+     * 用于复用同一个虚拟机实例执行多个程序，缓冲区容量会被保留
+     */
+    void reset();
+
+    /**
+     * @brief 从断点或观察点处继续执行
+     *
+     * 只有上次停止原因是 Breakpoint 或 Watchpoint 时有效
+     */
+    void resume();
+
+    // ==================== 调试接口 ====================
+
+    /**
+     * @brief 在内存单元上设置观察点
+     *
+     * 执行会在访问该单元的指令之前停止，可先检查旧值再 resume()
+     *
+     * @param address 内存地址 (0-99)
+     * @param type 监视的访问类型
+     * @throws std::out_of_range 如果地址越界
+     */
+    void addWatchpoint(size_t address, WatchType type = WatchType::ReadWrite);
+
+    /**
+     * @brief 移除内存单元上的观察点
+     *
+     * @param address 内存地址 (0-99)
+     */
+    void removeWatchpoint(size_t address);
+
+    /**
+     * @brief 在指定指令地址设置断点（可附加累加器条件）
+     *
+     * @param pc 指令地址
+     * @param condition 累加器条件（可选）
+     * @return 断点序号
+     */
+    size_t addBreakpoint(int pc, std::optional<AccumulatorCondition> condition = std::nullopt);
+
+    /**
+     * @brief 设置只依赖累加器的条件断点（条件由假变真时停止）
+     *
+     * @param condition 累加器条件
+     * @return 断点序号
+     */
+    size_t addBreakpoint(AccumulatorCondition condition);
+
+    /**
+     * @brief 清除所有观察点和断点
+     */
+    void clearDebugPoints();
+
+    /**
+     * @brief 检查是否设置了任何观察点或断点
+     */
+    [[nodiscard]] bool debugArmed() const
+    {
+        return !breakpoints_.empty() || readWatch_.any() || writeWatch_.any();
+    }
+
+    /**
+     * @brief 获取上次停止的原因
+     */
+    [[nodiscard]] const StopEvent& getLastStop() const { return lastStop_; }
+
+    // ==================== I/O 与执行配置 ====================
+
+    /**
+     * @brief 设置 I/O 模式
+     *
+     * @param enabled true 使用终端（默认），false 使用输入/输出缓冲区
+     */
+    void setConsoleIO(bool enabled) { context_.consoleIO = enabled; }
+
+    /**
+     * @brief 设置缓冲区模式下 READ 指令使用的输入序列
+     *
+     * @param inputs 输入序列
+     */
+    void setInputs(std::span<const int> inputs) { context_.setInputs(inputs); }
+
+    /**
+     * @brief 设置单次执行的最大指令数，防止死循环的程序占用线程
+     *
+     * @param limit 最大指令数（0 表示不限制）
+     */
+    void setStepLimit(std::uint64_t limit) { stepLimit_ = limit; }
+
     // ==================== 状态查询接口 ====================
 
     /**
@@ -78,4 +203,26 @@ public:
      * 显示累加器、指令计数器、指令寄存器的值
      */
     void dumpRegisters() const;
+
+    /**
+     * @brief 获取缓冲区模式下 WRITE 指令的输出
+     */
+    [[nodiscard]] const std::vector<int>& getOutputs() const { return context_.outputs; }
+
+    /**
+     * @brief 获取累加器的值
+     */
+    [[nodiscard]] int getAccumulator() const { return context_.accumulator; }
+
+    /**
+     * @brief 获取上次执行的指令数
+     */
+    [[nodiscard]] std::uint64_t getSteps() const { return steps_; }
+
+    /**
+     * @brief 获取上次执行的运行时错误
+     *
+     * @return 错误信息，正常结束时为空字符串
+     */
+    [[nodiscard]] const std::string& getLastError() const { return lastError_; }
 };
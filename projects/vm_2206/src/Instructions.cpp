@@ -5,9 +5,15 @@
 
 // ==================== I/O 指令实现 ====================
 
-// READ 指令：从标准输入读取一个整数
+// READ 指令：从标准输入（或输入缓冲区）读取一个整数
 void ReadInstruction::execute(VMContext& context, int operand)
 {
+    if (!context.consoleIO)
+    {
+        context.setMemory(operand, context.readInput());
+        return;
+    }
+
     std::cout << "请输入一个整数: ";
     int value;
     std::cin >> value;
@@ -19,9 +25,19 @@ std::string ReadInstruction::getName() const
     return "READ";
 }
 
-// WRITE 指令：将内存值输出到标准输出
+MemoryAccess ReadInstruction::memoryAccess() const
+{
+    return MemoryAccess::Write;
+}
+
+// WRITE 指令：将内存值输出到标准输出（或输出缓冲区）
 void WriteInstruction::execute(VMContext& context, int operand)
 {
+    if (!context.consoleIO)
+    {
+        context.writeOutput(context.getMemory(operand));
+        return;
+    }
     std::cout << context.getMemory(operand) << std::endl;
 }
 
@@ -30,6 +46,11 @@ std::string WriteInstruction::getName() const
     return "WRITE";
 }
 
+MemoryAccess WriteInstruction::memoryAccess() const
+{
+    return MemoryAccess::Read;
+}
+
 // ==================== 加载/存储指令实现 ====================
 
 // LOAD 指令：将内存值加载到累加器
@@ -43,6 +64,11 @@ std::string LoadInstruction::getName() const
     return "LOAD";
 }
 
+MemoryAccess LoadInstruction::memoryAccess() const
+{
+    return MemoryAccess::Read;
+}
+
 // STORE 指令：将累加器值存储到内存
 void StoreInstruction::execute(VMContext& context, int operand)
 {
@@ -54,6 +80,11 @@ std::string StoreInstruction::getName() const
     return "STORE";
 }
 
+MemoryAccess StoreInstruction::memoryAccess() const
+{
+    return MemoryAccess::Write;
+}
+
 // ==================== 算术指令实现 ====================
 
 // 定义通用流程：读取内存 -> 计算 -> 写回累加器
@@ -63,6 +94,11 @@ void ArithmeticInstruction::execute(VMContext& context, int operand)
     context.accumulator = compute(context.accumulator, value); // 执行运算
 }
 
+MemoryAccess ArithmeticInstruction::memoryAccess() const
+{
+    return MemoryAccess::Read;
+}
+
 // ADD 指令：加法运算
 int AddInstruction::compute(const int accumulator, const int operand) const
 {
@@ -169,7 +205,10 @@ std::string JumpZeroInstruction::getName() const
 // HALT 指令：停止虚拟机
 void HaltInstruction::execute(VMContext& context, [[maybe_unused]] int operand)
 {
-    std::cout << "程序执行完毕。" << std::endl;
+    if (context.consoleIO)
+    {
+        std::cout << "程序执行完毕。" << std::endl;
+    }
     context.running = false; // 停止运行
 }
 
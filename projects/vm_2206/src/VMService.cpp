@@ -0,0 +1,263 @@
+#include "../include/VMService.h"
+
+#include "VirtualMachine.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+/**
+ * @file VMService.cpp
+ * @brief 虚拟机工作线程池实现
+ */
+
+// ==================== 延迟直方图 ====================
+
+// 记录一次延迟：小于 16ns 的值各占一个桶，之后每个 2 的幂区间分 8 个子桶
+void VMService::LatencyHistogram::record(std::uint64_t nanos)
+{
+    size_t index;
+    if (nanos < 16)
+    {
+        index = static_cast<size_t>(nanos);
+    }
+    else
+    {
+        const auto exponent = static_cast<size_t>(std::bit_width(nanos) - 1); // >= 4
+        const auto sub = static_cast<size_t>(nanos >> (exponent - 3)) & (SUB_BUCKETS - 1);
+        index = 16 + (exponent - 4) * SUB_BUCKETS + sub;
+    }
+    // 只有所属工作线程写入，relaxed 即可
+    counts_[index].fetch_add(1, std::memory_order_relaxed);
+}
+
+void VMService::LatencyHistogram::mergeInto(std::array<std::uint64_t, BUCKET_COUNT>& totals) const
+{
+    for (size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        totals[i] += counts_[i].load(std::memory_order_relaxed);
+    }
+}
+
+std::uint64_t VMService::LatencyHistogram::bucketLowerBound(size_t index)
+{
+    if (index < 16)
+    {
+        return index;
+    }
+    const size_t exponent = (index - 16) / SUB_BUCKETS + 4;
+    const size_t sub = (index - 16) % SUB_BUCKETS;
+    return (std::uint64_t{1} << exponent) + (static_cast<std::uint64_t>(sub) << (exponent - 3));
+}
+
+// ==================== 服务 ====================
+
+VMService::VMService(size_t workerCount, size_t queueCapacity, std::uint64_t stepLimit)
+    : queue_(queueCapacity), stepLimit_(stepLimit), startTime_(Clock::now())
+{
+    if (workerCount == 0)
+    {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    workers_.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    // 所有 Worker 对象就绪后再启动线程
+    for (auto& worker : workers_)
+    {
+        worker->thread = std::thread(&VMService::workerLoop, this, std::ref(*worker));
+    }
+}
+
+VMService::~VMService()
+{
+    shutdown();
+}
+
+VMService::Task VMService::makeTask(const Program& program, std::vector<int> inputs)
+{
+    Task task;
+    task.program = program;
+    task.inputs = std::move(inputs);
+    task.submitTime = Clock::now();
+    return task;
+}
+
+void VMService::notifyWorker()
+{
+    submitSignal_.fetch_add(1, std::memory_order_release);
+    submitSignal_.notify_one();
+}
+
+std::future<VMResult> VMService::submit(const Program& program, std::vector<int> inputs)
+{
+    // 先登记为活跃提交方再检查 stopping_，与 shutdown() 的"先置位再等待"配对：
+    // 要么这里看到 stopping_，要么 shutdown() 等到本次提交结束后再清空队列
+    SubmitGuard guard(activeSubmitters_);
+    if (stopping_.load())
+    {
+        throw std::runtime_error("服务已停止");
+    }
+
+    Task task = makeTask(program, std::move(inputs));
+    auto future = task.promise.get_future();
+
+    // 队列满时让出 CPU，等待工作线程消费；期间服务停止则放弃（工作线程可能已退出）
+    while (!queue_.tryPush(task))
+    {
+        if (stopping_.load())
+        {
+            throw std::runtime_error("服务已停止");
+        }
+        std::this_thread::yield();
+    }
+    notifyWorker();
+    return future;
+}
+
+std::optional<std::future<VMResult>> VMService::trySubmit(const Program& program,
+                                                          std::vector<int> inputs)
+{
+    SubmitGuard guard(activeSubmitters_);
+    if (stopping_.load())
+    {
+        throw std::runtime_error("服务已停止");
+    }
+
+    Task task = makeTask(program, std::move(inputs));
+    auto future = task.promise.get_future();
+
+    if (!queue_.tryPush(task))
+    {
+        return std::nullopt;
+    }
+    notifyWorker();
+    return future;
+}
+
+void VMService::shutdown()
+{
+    if (stopping_.exchange(true))
+    {
+        return; // 已经停止
+    }
+
+    // 唤醒所有空闲线程，让它们处理完剩余作业后退出
+    submitSignal_.fetch_add(1, std::memory_order_release);
+    submitSignal_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+
+    // 等待与 shutdown 并发的提交方结束：它们要么放弃提交，要么已把作业放入队列
+    while (activeSubmitters_.load() != 0)
+    {
+        std::this_thread::yield();
+    }
+
+    // 工作线程退出后才入队、未被处理的作业：通知调用方
+    Task task;
+    while (queue_.tryPop(task))
+    {
+        task.promise.set_exception(std::make_exception_ptr(std::runtime_error("服务已停止")));
+    }
+}
+
+void VMService::workerLoop(Worker& worker)
+{
+    // 每个工作线程独占一个虚拟机，作业之间复用
+    VirtualMachine vm;
+    vm.setConsoleIO(false);
+    vm.setStepLimit(stepLimit_);
+
+    Task task;
+    for (;;)
+    {
+        // 先读取信号值再尝试出队，避免丢失入队通知
+        const std::uint64_t seen = submitSignal_.load(std::memory_order_acquire);
+
+        if (!queue_.tryPop(task))
+        {
+            if (stopping_.load(std::memory_order_acquire))
+            {
+                return; // 队列已空且服务停止
+            }
+            submitSignal_.wait(seen, std::memory_order_acquire);
+            continue;
+        }
+
+        vm.reset();
+        vm.loadProgram(task.program);
+        vm.setInputs(task.inputs);
+        vm.execute();
+
+        VMResult result;
+        result.success = vm.getLastError().empty();
+        result.error = vm.getLastError();
+        result.outputs = vm.getOutputs();
+        result.accumulator = vm.getAccumulator();
+        result.steps = vm.getSteps();
+        result.latency = Clock::now() - task.submitTime;
+
+        worker.latency.record(static_cast<std::uint64_t>(result.latency.count()));
+        worker.completed.fetch_add(1, std::memory_order_relaxed);
+        task.promise.set_value(std::move(result));
+    }
+}
+
+VMServiceMetrics VMService::getMetrics() const
+{
+    VMServiceMetrics metrics;
+    metrics.queueDepth = queue_.sizeApprox();
+
+    std::array<std::uint64_t, LatencyHistogram::BUCKET_COUNT> totals{};
+    for (const auto& worker : workers_)
+    {
+        metrics.completedJobs += worker->completed.load(std::memory_order_relaxed);
+        worker->latency.mergeInto(totals);
+    }
+
+    const std::chrono::duration<double> elapsed = Clock::now() - startTime_;
+    if (elapsed.count() > 0.0)
+    {
+        metrics.jobsPerSecond = static_cast<double>(metrics.completedJobs) / elapsed.count();
+    }
+
+    // 按累计计数查找分位数所在的桶
+    std::uint64_t histogramTotal = 0;
+    for (const auto count : totals)
+    {
+        histogramTotal += count;
+    }
+    if (histogramTotal == 0)
+    {
+        return metrics;
+    }
+
+    auto percentile = [&](double p)
+    {
+        const auto target = static_cast<std::uint64_t>(p * static_cast<double>(histogramTotal - 1));
+        std::uint64_t cumulative = 0;
+        for (size_t i = 0; i < totals.size(); ++i)
+        {
+            cumulative += totals[i];
+            if (cumulative > target)
+            {
+                return static_cast<double>(LatencyHistogram::bucketLowerBound(i)) / 1000.0;
+            }
+        }
+        return 0.0;
+    };
+
+    metrics.p50LatencyMicros = percentile(0.50);
+    metrics.p99LatencyMicros = percentile(0.99);
+    return metrics;
+}
@@ -16,32 +16,228 @@ void VirtualMachine::loadProgram(const std::array<int, VMContext::MEMORY_SIZE>&
     context_.memory = program;
 }
 
-// 执行程序（主循环）
+// 执行程序（从地址 0 开始）
 void VirtualMachine::execute()
 {
     context_.running = true;         // 启动虚拟机
     context_.instructionCounter = 0; // PC从0开始
+    steps_ = 0;
+    lastError_.clear();
+    lastStop_ = StopEvent{};
+    resumeFrom_ = StopReason::None;
+    for (auto& breakpoint : breakpoints_)
+    {
+        breakpoint.lastMatched = false;
+    }
+
+    run();
+}
+
+// 从断点/观察点处继续执行
+void VirtualMachine::resume()
+{
+    if (lastStop_.reason != StopReason::Breakpoint && lastStop_.reason != StopReason::Watchpoint)
+    {
+        return;
+    }
+    context_.running = true;
+    resumeFrom_ = lastStop_.reason; // 停止位置的指令不再重复触发同一类调试点
+    run();
+}
 
-    // 主执行循环
+// 选择执行循环：调试条件只在进入循环时判断一次
+void VirtualMachine::run()
+{
+    if (debugArmed())
+    {
+        runLoop<true>();
+    }
+    else
+    {
+        runLoop<false>();
+    }
+}
+
+// 主执行循环
+template <bool Debug>
+void VirtualMachine::runLoop()
+{
     while (context_.running)
     {
         try
         {
+            if constexpr (Debug)
+            {
+                const bool stop = checkDebugStop();
+                resumeFrom_ = StopReason::None;
+                if (stop)
+                {
+                    context_.running = false; // 暂停，保留所有状态以便 resume()
+                    return;
+                }
+            }
+
+            if (stepLimit_ != 0 && steps_ >= stepLimit_)
+            {
+                throw std::runtime_error("超出最大指令数: " + std::to_string(stepLimit_));
+            }
             executeSingleInstruction(); // 执行一条指令
+            ++steps_;
         }
         catch (const std::exception& e)
         {
             // 捕获运行时错误（如除零、未知操作码等）
-            std::cerr << "运行时错误: " << e.what() << std::endl;
+            lastError_ = e.what();
+            if (context_.consoleIO)
+            {
+                std::cerr << "运行时错误: " << e.what() << std::endl;
+            }
             context_.running = false;
+            lastStop_ = StopEvent{StopReason::Error, context_.instructionCounter};
+            return;
+        }
+    }
+    lastStop_ = StopEvent{StopReason::Halted, context_.instructionCounter};
+}
+
+// 检查断点和观察点（在指令执行之前调用）
+bool VirtualMachine::checkDebugStop()
+{
+    const int pc = context_.instructionCounter;
+
+    // 从观察点恢复：这条指令的所有检查都已完成
+    if (resumeFrom_ == StopReason::Watchpoint)
+    {
+        return false;
+    }
+
+    // 1. 条件断点（从断点恢复时跳过，但仍检查观察点）
+    for (size_t i = 0; resumeFrom_ != StopReason::Breakpoint && i < breakpoints_.size(); ++i)
+    {
+        Breakpoint& breakpoint = breakpoints_[i];
+        bool hit;
+        if (breakpoint.pc.has_value())
+        {
+            hit = *breakpoint.pc == pc && (!breakpoint.condition.has_value() ||
+                                          breakpoint.condition->matches(context_.accumulator));
         }
+        else
+        {
+            // 纯累加器条件：边沿触发
+            const bool matched = breakpoint.condition->matches(context_.accumulator);
+            hit = matched && !breakpoint.lastMatched;
+            breakpoint.lastMatched = matched;
+        }
+
+        if (hit)
+        {
+            lastStop_ = StopEvent{StopReason::Breakpoint, pc, i};
+            return true;
+        }
+    }
+
+    // 2. 观察点：解码当前指令，判断它是否访问被监视的内存单元
+    if (pc < 0 || static_cast<size_t>(pc) >= VMContext::MEMORY_SIZE)
+    {
+        return false; // 交给 executeSingleInstruction 报告越界
+    }
+    const int instruction = context_.memory[pc];
+    const int operand = instruction % 100;
+    if (operand < 0 || !(readWatch_.test(operand) || writeWatch_.test(operand)))
+    {
+        return false;
+    }
+
+    const auto instructionOpt = factory_.getInstruction(static_cast<OpCode>(instruction / 100));
+    if (!instructionOpt.has_value())
+    {
+        return false;
+    }
+
+    const MemoryAccess access = instructionOpt.value()->memoryAccess();
+    if (access == MemoryAccess::Read && readWatch_.test(operand))
+    {
+        lastStop_ = StopEvent{StopReason::Watchpoint, pc, 0, static_cast<size_t>(operand),
+                              WatchType::Read};
+        return true;
+    }
+    if (access == MemoryAccess::Write && writeWatch_.test(operand))
+    {
+        lastStop_ = StopEvent{StopReason::Watchpoint, pc, 0, static_cast<size_t>(operand),
+                              WatchType::Write};
+        return true;
+    }
+    return false;
+}
+
+// 设置观察点
+void VirtualMachine::addWatchpoint(size_t address, WatchType type)
+{
+    if (address >= VMContext::MEMORY_SIZE)
+    {
+        throw std::out_of_range("内存地址越界");
+    }
+    const auto bits = static_cast<unsigned>(type);
+    if (bits & static_cast<unsigned>(WatchType::Read))
+    {
+        readWatch_.set(address);
+    }
+    if (bits & static_cast<unsigned>(WatchType::Write))
+    {
+        writeWatch_.set(address);
     }
 }
 
+// 移除观察点
+void VirtualMachine::removeWatchpoint(size_t address)
+{
+    if (address < VMContext::MEMORY_SIZE)
+    {
+        readWatch_.reset(address);
+        writeWatch_.reset(address);
+    }
+}
+
+// 设置地址断点
+size_t VirtualMachine::addBreakpoint(int pc, std::optional<AccumulatorCondition> condition)
+{
+    breakpoints_.push_back(Breakpoint{pc, condition});
+    return breakpoints_.size() - 1;
+}
+
+// 设置累加器条件断点
+size_t VirtualMachine::addBreakpoint(AccumulatorCondition condition)
+{
+    breakpoints_.push_back(Breakpoint{std::nullopt, condition});
+    return breakpoints_.size() - 1;
+}
+
+// 清除所有调试点
+void VirtualMachine::clearDebugPoints()
+{
+    readWatch_.reset();
+    writeWatch_.reset();
+    breakpoints_.clear();
+}
+
+// 重置虚拟机
+void VirtualMachine::reset()
+{
+    context_.reset();
+    steps_ = 0;
+    lastError_.clear();
+    lastStop_ = StopEvent{};
+}
+
 // 执行单条指令（Fetch-Decode-Execute 循环）
 void VirtualMachine::executeSingleInstruction()
 {
     // 1. 取指（Fetch）：从内存读取当前指令
+    if (context_.instructionCounter < 0 ||
+        static_cast<size_t>(context_.instructionCounter) >= VMContext::MEMORY_SIZE)
+    {
+        throw std::runtime_error("指令计数器越界: " + std::to_string(context_.instructionCounter));
+    }
     context_.instructionRegister = context_.memory[context_.instructionCounter];
 
     // 2. 解码（Decode）：分离操作码和操作数
@@ -1,7 +1,59 @@
 #include "../include/ProgramBuilder.h"
 #include "VirtualMachine.h"
+#include "VMService.h"
 
+#include <future>
 #include <iostream>
+#include <vector>
+
+// 服务模式演示：多个作业并发提交给工作线程池
+static int runServiceDemo()
+{
+    constexpr int JOB_COUNT = 100000;
+
+    std::cout << "=== 示例 4: 服务模式 ===" << std::endl;
+    std::cout << "向工作线程池提交 " << JOB_COUNT << " 个两数相加作业。\n" << std::endl;
+
+    // 与示例程序 1 相同的加法程序，输入来自作业而不是终端
+    const auto program = ProgramBuilder()
+                             .addInstruction(+1007) // READ 07
+                             .addInstruction(+1008) // READ 08
+                             .addInstruction(+2007) // LOAD 07
+                             .addInstruction(+3008) // ADD 08
+                             .addInstruction(+2109) // STORE 09
+                             .addInstruction(+1109) // WRITE 09
+                             .addInstruction(+4300) // HALT
+                             .build();
+
+    VMService service;
+    std::vector<std::future<VMResult>> futures;
+    futures.reserve(JOB_COUNT);
+    for (int i = 0; i < JOB_COUNT; ++i)
+    {
+        futures.push_back(service.submit(program, {i, 2 * i}));
+    }
+
+    int failures = 0;
+    for (int i = 0; i < JOB_COUNT; ++i)
+    {
+        const VMResult result = futures[i].get();
+        if (!result.success || result.outputs.size() != 1 || result.outputs[0] != 3 * i)
+        {
+            ++failures;
+        }
+    }
+
+    const VMServiceMetrics metrics = service.getMetrics();
+    std::cout << "工作线程数: " << service.workerCount() << std::endl;
+    std::cout << "完成作业数: " << metrics.completedJobs << "（错误结果: " << failures << "）"
+              << std::endl;
+    std::cout << "队列深度: " << metrics.queueDepth << std::endl;
+    std::cout << "吞吐量: " << static_cast<long long>(metrics.jobsPerSecond) << " jobs/s" << std::endl;
+    std::cout << "延迟 p50: " << metrics.p50LatencyMicros << " us" << std::endl;
+    std::cout << "延迟 p99: " << metrics.p99LatencyMicros << " us" << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
 
 int main()
 {
@@ -16,12 +68,18 @@ int main()
     std::cout << "1. 两数相加" << std::endl;
     std::cout << "2. 两数相减（含条件分支）" << std::endl;
     std::cout << "3. 乘法运算" << std::endl;
-    std::cout << "请输入选择 (1-3): ";
+    std::cout << "4. 服务模式（并发执行作业）" << std::endl;
+    std::cout << "请输入选择 (1-4): ";
 
     int choice;
     std::cin >> choice;
     std::cout << std::endl;
 
+    if (choice == 4)
+    {
+        return runServiceDemo();
+    }
+
     // 创建虚拟机和程序构建器
     VirtualMachine vm;
     ProgramBuilder builder;